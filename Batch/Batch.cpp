@@ -0,0 +1,676 @@
+#include "../Headers/Batch.h"
+#include "../Headers/Runner.h"
+#include "../Headers/ThreadPool.h"
+#include "../Headers/TraceIO.h"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <random>
+#include <cmath>
+#include <map>
+#include <algorithm>
+
+void printBatchUsage(std::ostream &out)
+{
+    out << "Usage: main --batch [options]\n"
+        << "Lists are comma-separated (a,b,c) or inclusive ranges (start:end:step).\n"
+        << "  --config FILE          Read options from FILE (key = value per line, # comments)\n"
+        << "  --heads LIST           Start head positions (default 50)\n"
+        << "  --cylinders LIST       Max cylinder numbers (default 199)\n"
+        << "  --sizes LIST           Queue sizes (default 100)\n"
+        << "  --patterns LIST        uniform, sequential, clustered, mixed, zipf, hotcold, locality\n"
+        << "                         (default uniform)\n"
+        << "  --clusters N           Clusters for the clustered pattern (default 5)\n"
+        << "  --zipf-exponent X      Zipf skew s, weight of rank k = 1/k^s; 0 = uniform (default 0.99)\n"
+        << "  --hot-fraction X       hotcold: share of the cylinders that are hot (default 0.2)\n"
+        << "  --hot-probability X    hotcold: share of the requests sent to them (default 0.8)\n"
+        << "  --run-length X         locality: mean sequential run length (default 16)\n"
+        << "  --drift-interval N     Requests between moves of the hot set, 0 = static (default 0)\n"
+        << "  --drift-fraction X     Share of the disk the hot set moves by (default 0.05)\n"
+        << "  --queue-file FILE      Use the queue in FILE (text, binary trace or '-' = stdin) instead of generated ones\n"
+        << "  --seek-ms LIST         Seek time per cylinder in ms (default 0.1)\n"
+        << "  --seek-curve S,A,B,K   Seek time settle + A*sqrt(d) up to K cylinders, then linear at B ms/cyl\n"
+        << "  --seek-profile FILE    Measured seek times, 'distance time_ms' per line\n"
+        << "  --rpm LIST             Rotational speed (default 7200)\n"
+        << "  --transfer-mbps LIST   Transfer rate in MB/s (default 100)\n"
+        << "  --request-kb LIST      Average request size in KB (default 4)\n"
+        << "  --inter-arrival-ms X   Gap between request arrivals (default 0)\n"
+        << "  --write-fraction X     Share of requests that are writes (default 0)\n"
+        << "  --nstep N              N-step SCAN group size (default 16)\n"
+        << "  --read-expire-ms X     mq-deadline read expiry (default 500)\n"
+        << "  --write-expire-ms X    mq-deadline write expiry (default 5000)\n"
+        << "  --fifo-batch N         mq-deadline batch size (default 16)\n"
+        << "  --writes-starved N     mq-deadline read batches before writes (default 2)\n"
+        << "  --sectors-per-track N  Model rotational position with N sectors per track (default 0 = off)\n"
+        << "  --trials K             Independent trials per configuration; K > 1 reports\n"
+        << "                         mean, stddev and 95% CI of every metric (default 1). Trial 0 uses\n"
+        << "                         queue_seed, later trials seeds derived from it\n"
+        << "  --percentiles 0|1      Add seek / service-time p50, p90, p99, p999 and max columns (default 0)\n"
+        << "  --head-sweep STEP      Instead of the algorithm table, write closed-form SCAN, C-SCAN, LOOK and\n"
+        << "                         C-LOOK metrics for start heads 0, STEP, 2*STEP, ... (heads are ignored;\n"
+        << "                         average rotational latency, no response times) (default 0 = off)\n"
+        << "  --seed N               Master seed (default 1)\n"
+        << "  --threads N            Worker threads, 0 = all cores (default 0)\n"
+        << "  --output FILE          CSV output path (default stdout)\n";
+}
+
+// Splits "a,b,c" or expands "start:end:step" into a list of T
+template <typename T>
+static bool parseList(const std::string &text, std::vector<T> &values, std::string &error)
+{
+    values.clear();
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        std::replace(item.begin(), item.end(), ':', ' ');
+        std::istringstream parts(item);
+        T start, end, step;
+        if (!(parts >> start))
+        {
+            error = "invalid list value '" + item + "'";
+            return false;
+        }
+        if (parts >> end)
+        {
+            if (!(parts >> step) || step <= 0)
+            {
+                error = "range '" + item + "' needs start:end:step with step > 0";
+                return false;
+            }
+            for (T v = start; v <= end + step * 1e-9; v += step)
+                values.push_back(v);
+        }
+        else
+        {
+            values.push_back(start);
+        }
+    }
+    if (values.empty())
+    {
+        error = "empty list";
+        return false;
+    }
+    return true;
+}
+
+bool parseNumberList(const std::string &text, std::vector<int> &values, std::string &error)
+{
+    return parseList(text, values, error);
+}
+
+bool parseNumberList(const std::string &text, std::vector<double> &values, std::string &error)
+{
+    return parseList(text, values, error);
+}
+
+bool applyBatchOption(const std::string &key, const std::string &value, BatchConfig &config, std::string &error)
+{
+    bool ok = true;
+    if (key == "heads")
+        ok = parseList(value, config.startHeads, error);
+    else if (key == "cylinders")
+        ok = parseList(value, config.maxCylinders, error);
+    else if (key == "sizes")
+        ok = parseList(value, config.queueSizes, error);
+    else if (key == "patterns")
+    {
+        config.patterns.clear();
+        std::stringstream ss(value);
+        std::string name;
+        while (std::getline(ss, name, ','))
+        {
+            QueuePattern pattern;
+            if (!parsePatternName(name, pattern))
+            {
+                error = "unknown pattern '" + name + "'";
+                return false;
+            }
+            config.patterns.push_back(pattern);
+        }
+        ok = !config.patterns.empty();
+    }
+    else if (key == "clusters")
+        config.numClusters = std::max(1, std::atoi(value.c_str()));
+    else if (key == "zipf-exponent")
+        config.workload.zipfExponent = std::max(0.0, std::atof(value.c_str()));
+    else if (key == "hot-fraction")
+        config.workload.hotFraction = std::min(1.0, std::max(0.0, std::atof(value.c_str())));
+    else if (key == "hot-probability")
+        config.workload.hotProbability = std::min(1.0, std::max(0.0, std::atof(value.c_str())));
+    else if (key == "run-length")
+        config.workload.meanRunLength = std::max(1.0, std::atof(value.c_str()));
+    else if (key == "drift-interval")
+        config.workload.driftInterval = std::max(0ll, std::atoll(value.c_str()));
+    else if (key == "drift-fraction")
+        config.workload.driftFraction = std::min(1.0, std::max(0.0, std::atof(value.c_str())));
+    else if (key == "seek-ms")
+        ok = parseList(value, config.seekTimesMs, error);
+    else if (key == "rpm")
+        ok = parseList(value, config.rpms, error);
+    else if (key == "transfer-mbps")
+        ok = parseList(value, config.transferRatesMBps, error);
+    else if (key == "request-kb")
+        ok = parseList(value, config.requestSizesKB, error);
+    else if (key == "inter-arrival-ms")
+        config.interArrivalMs = std::max(0.0, std::atof(value.c_str()));
+    else if (key == "write-fraction")
+        config.writeFraction = std::min(1.0, std::max(0.0, std::atof(value.c_str())));
+    else if (key == "nstep")
+        config.fairParams.nStep = std::max(1, std::atoi(value.c_str()));
+    else if (key == "read-expire-ms")
+        config.fairParams.readExpireMs = std::atof(value.c_str());
+    else if (key == "write-expire-ms")
+        config.fairParams.writeExpireMs = std::atof(value.c_str());
+    else if (key == "fifo-batch")
+        config.fairParams.fifoBatch = std::max(1, std::atoi(value.c_str()));
+    else if (key == "writes-starved")
+        config.fairParams.writesStarved = std::max(0, std::atoi(value.c_str()));
+    else if (key == "seek-curve")
+        config.seekCurveSpec = value;
+    else if (key == "seek-profile")
+        config.seekProfilePath = value;
+    else if (key == "queue-file")
+        config.queueFile = value;
+    else if (key == "sectors-per-track")
+        config.sectorsPerTrack = std::max(0, std::atoi(value.c_str()));
+    else if (key == "trials")
+        config.trials = std::max(1, std::atoi(value.c_str()));
+    else if (key == "head-sweep")
+        config.headSweepStep = std::max(0, std::atoi(value.c_str()));
+    else if (key == "percentiles")
+        config.percentiles = (value == "1" || value == "on" || value == "true");
+    else if (key == "seed")
+        config.seed = std::strtoull(value.c_str(), nullptr, 10);
+    else if (key == "threads")
+        config.numThreads = std::strtoul(value.c_str(), nullptr, 10);
+    else if (key == "output")
+        config.outputPath = value;
+    else if (key == "config")
+        ok = loadBatchConfigFile(value, config, error);
+    else
+    {
+        error = "unknown option '" + key + "'";
+        return false;
+    }
+    if (!ok && error.empty())
+        error = "invalid value for '" + key + "'";
+    else if (!ok)
+        error = key + ": " + error;
+    return ok;
+}
+
+static std::string trim(const std::string &s)
+{
+    size_t first = s.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos)
+        return "";
+    return s.substr(first, s.find_last_not_of(" \t\r\n") - first + 1);
+}
+
+bool loadBatchConfigFile(const std::string &path, BatchConfig &config, std::string &error)
+{
+    std::ifstream in(path);
+    if (!in)
+    {
+        error = "cannot open config file '" + path + "'";
+        return false;
+    }
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line))
+    {
+        lineNumber++;
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty())
+            continue;
+        size_t eq = line.find('=');
+        if (eq == std::string::npos)
+        {
+            error = path + ":" + std::to_string(lineNumber) + ": expected 'key = value'";
+            return false;
+        }
+        if (!applyBatchOption(trim(line.substr(0, eq)), trim(line.substr(eq + 1)), config, error))
+        {
+            error = path + ":" + std::to_string(lineNumber) + ": " + error;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool parseBatchArgs(int argc, char *argv[], BatchConfig &config, std::string &error)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--batch")
+            continue;
+        if (arg.rfind("--", 0) != 0 || i + 1 >= argc)
+        {
+            error = "expected '--option value', got '" + arg + "'";
+            return false;
+        }
+        if (!applyBatchOption(arg.substr(2), argv[++i], config, error))
+            return false;
+    }
+    return true;
+}
+
+namespace
+{
+    struct BatchCase
+    {
+        int startHead;
+        int maxCylinder;
+        int queueSize;
+        QueuePattern pattern;
+        double seekTimeMs, rpm, transferRateMBps, requestSizeKB;
+        uint64_t queueSeed;
+    };
+
+    // One start head of a head sweep
+    struct HeadSweepRow
+    {
+        long long totalMovement;
+        int maxSeek;
+        double avgSeek, stdDevSeek, throughput, avgResponseMs;
+    };
+
+    const ElevatorAlgorithm sweepAlgorithms[] = {ElevatorAlgorithm::Scan, ElevatorAlgorithm::CScan, ElevatorAlgorithm::Look,
+                                                 ElevatorAlgorithm::CLook};
+}
+
+// Head-sweep CSV: one row per (configuration, algorithm, start head)
+static void writeHeadSweep(std::ostream &out, const BatchConfig &config, const std::vector<BatchCase> &cases,
+                           const std::vector<std::vector<HeadSweepRow>> &sweeps, int trials, bool useFileQueue)
+{
+    out << "config,start_head,max_cylinder,num_requests,pattern,seek_ms_per_cyl,rpm,transfer_mbps,request_kb,"
+           "queue_seed,algorithm";
+    const char *fieldNames[] = {"total_movement", "avg_seek", "max_seek", "stddev_seek", "throughput", "avg_response_ms"};
+    if (trials == 1)
+    {
+        for (const char *field : fieldNames)
+            out << "," << field;
+    }
+    else
+    {
+        out << ",trials";
+        for (const char *field : fieldNames)
+            out << "," << field << "_mean," << field << "_stddev," << field << "_ci95";
+    }
+    out << "\n";
+    out << std::setprecision(10);
+
+    auto writeValue = [&out](double value)
+    {
+        if (std::isinf(value))
+            out << "inf";
+        else
+            out << value;
+    };
+    int step = std::max(1, config.headSweepStep);
+    for (size_t c = 0; c < cases.size(); ++c)
+    {
+        const BatchCase &bc = cases[c];
+        size_t numHeads = sweeps[c * trials].size() / 4;
+        for (size_t a = 0; a < 4; ++a)
+        {
+            for (size_t h = 0; h < numHeads; ++h)
+            {
+                out << c << "," << h * step << "," << bc.maxCylinder << "," << bc.queueSize << ","
+                    << (useFileQueue ? "file" : patternName(bc.pattern)) << "," << bc.seekTimeMs << "," << bc.rpm << ","
+                    << bc.transferRateMBps << "," << bc.requestSizeKB << "," << bc.queueSeed << ","
+                    << elevatorName(sweepAlgorithms[a]);
+                if (trials == 1)
+                {
+                    const HeadSweepRow &row = sweeps[c][a * numHeads + h];
+                    out << "," << row.totalMovement << "," << row.avgSeek << "," << row.maxSeek << "," << row.stdDevSeek << ",";
+                    writeValue(row.throughput);
+                    out << "," << row.avgResponseMs << "\n";
+                    continue;
+                }
+                std::vector<double> fields[6];
+                for (int t = 0; t < trials; ++t)
+                {
+                    const HeadSweepRow &row = sweeps[c * trials + t][a * numHeads + h];
+                    fields[0].push_back(static_cast<double>(row.totalMovement));
+                    fields[1].push_back(row.avgSeek);
+                    fields[2].push_back(row.maxSeek);
+                    fields[3].push_back(row.stdDevSeek);
+                    fields[4].push_back(row.throughput);
+                    fields[5].push_back(row.avgResponseMs);
+                }
+                out << "," << trials;
+                for (const std::vector<double> &values : fields)
+                {
+                    TrialSummary summary = summarizeTrials(values);
+                    out << ",";
+                    writeValue(summary.mean);
+                    out << "," << summary.stdDev << "," << summary.ci95;
+                }
+                out << "\n";
+            }
+        }
+    }
+}
+
+int runBatch(const BatchConfig &config)
+{
+    // A queue file is parsed once and shared read-only by every task
+    std::vector<int> fileQueue;
+    bool useFileQueue = !config.queueFile.empty();
+    if (useFileQueue)
+    {
+        std::string error;
+        if (!loadQueueFile(config.queueFile, fileQueue, error))
+        {
+            std::cerr << "Error: " << error << std::endl;
+            return 1;
+        }
+        if (fileQueue.empty())
+        {
+            std::cerr << "Error: queue file '" << config.queueFile << "' contains no requests." << std::endl;
+            return 1;
+        }
+        if (*std::min_element(fileQueue.begin(), fileQueue.end()) < 0)
+        {
+            std::cerr << "Error: queue file '" << config.queueFile << "' has negative cylinders." << std::endl;
+            return 1;
+        }
+    }
+    const std::vector<int> fileSizes = {static_cast<int>(fileQueue.size())};
+    const std::vector<QueuePattern> filePatterns = {QueuePattern::Uniform};
+    // A head sweep covers every head itself, so it needs one case per queue and disk
+    bool headSweep = config.headSweepStep > 0;
+    // Every trial replays the same file; only random sector positions can tell them apart
+    if (useFileQueue && config.trials > 1 && (config.sectorsPerTrack == 0 || headSweep))
+    {
+        std::cerr << "Error: --trials " << config.trials << " with --queue-file would repeat one identical run; "
+                  << "use --trials 1, or --sectors-per-track to vary sector positions between trials." << std::endl;
+        return 1;
+    }
+    const std::vector<int> sweepHeads = {0};
+
+    // Expand the Cartesian product. The queue depends only on (cylinders, size, pattern),
+    // so every head / disk-parameter combination is evaluated on the same queue.
+    std::vector<BatchCase> cases;
+    uint64_t queueIndex = 0;
+    for (int maxCylinder : config.maxCylinders)
+    {
+        if (useFileQueue && *std::max_element(fileQueue.begin(), fileQueue.end()) > maxCylinder)
+        {
+            std::cerr << "Warning: skipping max cylinder " << maxCylinder << ", the queue file has requests beyond it." << std::endl;
+            continue;
+        }
+        for (int queueSize : useFileQueue ? fileSizes : config.queueSizes)
+            for (QueuePattern pattern : useFileQueue ? filePatterns : config.patterns)
+            {
+                uint64_t queueSeed = deriveSeed(config.seed, queueIndex++);
+                for (int startHead : headSweep ? sweepHeads : config.startHeads)
+                {
+                    if (startHead < 0 || startHead > maxCylinder || queueSize < 1)
+                    {
+                        std::cerr << "Warning: skipping head " << startHead << " / max cylinder " << maxCylinder
+                                  << " / size " << queueSize << "." << std::endl;
+                        continue;
+                    }
+                    for (double seekTimeMs : config.seekTimesMs)
+                        for (double rpm : config.rpms)
+                            for (double transferRate : config.transferRatesMBps)
+                                for (double requestSize : config.requestSizesKB)
+                                    cases.push_back({startHead, maxCylinder, queueSize, pattern,
+                                                     seekTimeMs, rpm, transferRate, requestSize, queueSeed});
+                }
+            }
+    }
+
+    // Seek curves are tabulated once per disk size and shared by every task
+    std::map<int, std::shared_ptr<const SeekCurve>> seekCurves;
+    if (!config.seekProfilePath.empty() || !config.seekCurveSpec.empty())
+    {
+        for (int maxCylinder : config.maxCylinders)
+        {
+            std::string error;
+            std::shared_ptr<const SeekCurve> curve = !config.seekProfilePath.empty()
+                                                         ? loadSeekProfile(config.seekProfilePath, maxCylinder, error)
+                                                         : parseSeekCurveSpec(config.seekCurveSpec, maxCylinder, error);
+            if (!curve)
+            {
+                std::cerr << "Error: " << error << std::endl;
+                return 1;
+            }
+            seekCurves[maxCylinder] = curve;
+        }
+    }
+
+    // Skewed-pattern models (the Zipf alias table is O(cylinders)) likewise
+    std::map<std::pair<int, QueuePattern>, std::shared_ptr<const WorkloadModel>> workloadModels;
+    if (!useFileQueue)
+    {
+        for (int maxCylinder : config.maxCylinders)
+            for (QueuePattern pattern : config.patterns)
+                if (isSkewedPattern(pattern) && !workloadModels.count({maxCylinder, pattern}))
+                    workloadModels[{maxCylinder, pattern}] = buildWorkloadModel(pattern, maxCylinder, config.workload);
+    }
+
+    // One task per (configuration, trial). Trial 0 is generated from the queue seed printed in
+    // the CSV, so a single-trial row can be reproduced from that seed alone; trial t > 0 uses
+    // its own stream derived from it. Every task writes only its own slot, so the output does
+    // not depend on scheduling.
+    int trials = std::max(1, config.trials);
+    std::vector<std::vector<AlgorithmResult>> results(cases.size() * trials);
+    std::vector<std::vector<HeadSweepRow>> sweeps(headSweep ? cases.size() * trials : 0);
+    ThreadPool pool(config.numThreads);
+    for (size_t c = 0; c < cases.size(); ++c)
+    {
+        for (int t = 0; t < trials; ++t)
+        {
+            pool.submit([&, c, t]
+                        {
+                            const BatchCase &bc = cases[c];
+                            uint64_t trialSeed = (t == 0) ? bc.queueSeed : deriveSeed(bc.queueSeed, t);
+                            std::seed_seq seq{static_cast<uint32_t>(trialSeed), static_cast<uint32_t>(trialSeed >> 32)};
+                            std::mt19937 rng(seq);
+                            std::vector<int> queue;
+                            if (useFileQueue)
+                                queue = fileQueue;
+                            else if (isSkewedPattern(bc.pattern))
+                                queue = generateWorkload(*workloadModels.at({bc.maxCylinder, bc.pattern}), bc.queueSize, trialSeed);
+                            else
+                                queue = generatePattern(bc.pattern, bc.maxCylinder, bc.queueSize, config.numClusters, rng);
+                            DiskPerformanceParams diskParams = deriveDiskParams(bc.seekTimeMs, bc.rpm, bc.transferRateMBps, bc.requestSizeKB);
+                            if (!seekCurves.empty())
+                                diskParams.seekCurve = seekCurves.at(bc.maxCylinder);
+                            if (headSweep)
+                            {
+                                // Closed form for every head: no sequence is built, nothing is sorted twice
+                                ElevatorProfile profile(compressQueue(queue), diskParams);
+                                std::vector<HeadSweepRow> &slot = sweeps[c * trials + t];
+                                for (ElevatorAlgorithm algorithm : sweepAlgorithms)
+                                {
+                                    for (const ElevatorTotals &totals : profile.sweepHeads(algorithm, bc.maxCylinder, config.headSweepStep))
+                                    {
+                                        AlgorithmResult r = profile.result(algorithm, totals);
+                                        slot.push_back({r.totalMovement, r.maxSeek, r.avgSeek, r.stdDevSeek, r.throughput, r.avgResponseTime});
+                                    }
+                                }
+                                return;
+                            }
+                            PreparedQueue prepared = prepareQueue(bc.startHead, queue);
+                            std::vector<Request> requests = makeRequests(queue, bc.requestSizeKB, config.interArrivalMs, config.writeFraction);
+                            diskParams.geometry = makeDiskGeometry(config.sectorsPerTrack, bc.rpm);
+                            assignSectors(requests, diskParams.geometry, deriveSeed(trialSeed, 1));
+                            // Parallelism is across configurations and trials; the algorithms run in turn here
+                            std::vector<AlgorithmResult> &slot = results[c * trials + t];
+                            MetricsOptions options;
+                            options.collectPercentiles = config.percentiles;
+                            for (const AlgorithmJob &job : standardAlgorithmJobs(bc.startHead, bc.maxCylinder, queue, prepared, diskParams, &requests, options, config.fairParams))
+                                slot.push_back(job.run()); });
+        }
+    }
+    pool.wait();
+
+    std::ofstream file;
+    if (!config.outputPath.empty())
+    {
+        file.open(config.outputPath);
+        if (!file)
+        {
+            std::cerr << "Error: cannot write '" << config.outputPath << "'." << std::endl;
+            return 1;
+        }
+    }
+    std::ostream &out = config.outputPath.empty() ? std::cout : file;
+    if (headSweep)
+    {
+        writeHeadSweep(out, config, cases, sweeps, trials, useFileQueue);
+        std::cerr << "Batch: head sweep of " << cases.size() << " configurations x " << trials << " trials on "
+                  << pool.size() << " threads." << std::endl;
+        return 0;
+    }
+    out << "config,start_head,max_cylinder,num_requests,pattern,seek_ms_per_cyl,rpm,transfer_mbps,request_kb,"
+           "queue_seed,algorithm";
+    if (trials == 1)
+        out << ",total_movement,avg_seek,max_seek,stddev_seek,throughput,avg_response_ms,mean_response_ms,max_response_ms";
+    else
+    {
+        out << ",trials";
+        for (const char *field : {"total_movement", "avg_seek", "max_seek", "stddev_seek", "throughput", "avg_response_ms",
+                                  "mean_response_ms", "max_response_ms"})
+            out << "," << field << "_mean," << field << "_stddev," << field << "_ci95";
+    }
+    if (config.percentiles)
+        out << ",seek_p50,seek_p90,seek_p99,seek_p999,seek_max,service_p50_ms,service_p90_ms,service_p99_ms,"
+               "service_p999_ms,service_max_ms";
+    out << "\n";
+    out << std::setprecision(10);
+
+    auto writeValue = [&out](double value)
+    {
+        if (std::isinf(value))
+            out << "inf";
+        else
+            out << value;
+    };
+    auto writePercentiles = [&out](const LatencyHistogram &seek, const LatencyHistogram &service)
+    {
+        PercentileSummary s = summarizeHistogram(seek);
+        PercentileSummary v = summarizeHistogram(service, 0.001);
+        out << "," << s.p50 << "," << s.p90 << "," << s.p99 << "," << s.p999 << "," << s.max << "," << v.p50 << ","
+            << v.p90 << "," << v.p99 << "," << v.p999 << "," << v.max;
+    };
+    for (size_t c = 0; c < cases.size(); ++c)
+    {
+        const BatchCase &bc = cases[c];
+        size_t numAlgorithms = results[c * trials].size();
+        for (size_t a = 0; a < numAlgorithms; ++a)
+        {
+            const AlgorithmResult &first = results[c * trials][a];
+            out << c << "," << bc.startHead << "," << bc.maxCylinder << "," << bc.queueSize << ","
+                << (useFileQueue ? "file" : patternName(bc.pattern)) << "," << bc.seekTimeMs << "," << bc.rpm << ","
+                << bc.transferRateMBps << "," << bc.requestSizeKB << "," << bc.queueSeed << ","
+                << first.name;
+            if (trials == 1)
+            {
+                out << "," << first.totalMovement << "," << first.avgSeek << "," << first.maxSeek << ","
+                    << first.stdDevSeek << ",";
+                writeValue(first.throughput);
+                out << "," << first.avgResponseTime << "," << first.meanResponseMs << "," << first.maxResponseMs;
+                if (config.percentiles)
+                    writePercentiles(first.seekHistogram, first.serviceHistogram);
+                out << "\n";
+                continue;
+            }
+
+            // Aggregate each field over the trials, in trial order
+            std::vector<double> fields[8];
+            LatencyHistogram pooledSeek, pooledService;
+            for (int t = 0; t < trials; ++t)
+            {
+                const AlgorithmResult &r = results[c * trials + t][a];
+                pooledSeek.merge(r.seekHistogram);
+                pooledService.merge(r.serviceHistogram);
+                fields[0].push_back(static_cast<double>(r.totalMovement));
+                fields[1].push_back(r.avgSeek);
+                fields[2].push_back(r.maxSeek);
+                fields[3].push_back(r.stdDevSeek);
+                fields[4].push_back(r.throughput);
+                fields[5].push_back(r.avgResponseTime);
+                fields[6].push_back(r.meanResponseMs);
+                fields[7].push_back(r.maxResponseMs);
+            }
+            out << "," << trials;
+            for (const std::vector<double> &values : fields)
+            {
+                TrialSummary summary = summarizeTrials(values);
+                out << ",";
+                writeValue(summary.mean);
+                out << "," << summary.stdDev << "," << summary.ci95;
+            }
+            if (config.percentiles)
+                writePercentiles(pooledSeek, pooledService);
+            out << "\n";
+        }
+    }
+    std::cerr << "Batch: " << cases.size() << " configurations x " << trials << " trials on "
+              << pool.size() << " threads." << std::endl;
+    return 0;
+}
+
+// Two-sided 95% Student t critical values for 1..30 degrees of freedom
+static double tCritical95(size_t degreesOfFreedom)
+{
+    static const double table[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                   2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                   2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+    if (degreesOfFreedom == 0)
+        return 0.0;
+    if (degreesOfFreedom <= 30)
+        return table[degreesOfFreedom - 1];
+    return 1.95996 + 2.37 / degreesOfFreedom; // First Cornish-Fisher correction to the normal quantile
+}
+
+TrialSummary summarizeTrials(const std::vector<double> &values)
+{
+    TrialSummary summary;
+    if (values.empty())
+        return summary;
+    double mean = 0.0, m2 = 0.0;
+    size_t n = 0;
+    for (double v : values)
+    {
+        n++;
+        double delta = v - mean;
+        mean += delta / n;
+        m2 += delta * (v - mean);
+    }
+    summary.mean = mean;
+    if (n > 1)
+    {
+        summary.stdDev = std::sqrt(m2 / (n - 1)); // Sample standard deviation
+        summary.ci95 = tCritical95(n - 1) * summary.stdDev / std::sqrt(static_cast<double>(n));
+    }
+    return summary;
+}
+
+int batchMain(int argc, char *argv[])
+{
+    BatchConfig config;
+    std::string error;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::string(argv[i]) == "--help")
+        {
+            printBatchUsage(std::cout);
+            return 0;
+        }
+    }
+    if (!parseBatchArgs(argc, argv, config, error))
+    {
+        std::cerr << "Error: " << error << std::endl;
+        printBatchUsage(std::cerr);
+        return 1;
+    }
+    return runBatch(config);
+}
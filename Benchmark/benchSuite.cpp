@@ -0,0 +1,366 @@
+// Benchmark suite: times every scheduler in DiskScheduling.h plus calculateMetrics on all
+// four QueueGeneration patterns for queue sizes 10..10M, and reports ns/request, heap
+// allocations per call and peak RSS as CSV. The arrival-aware schedulers (MQ-DL, FSCAN,
+// N-SCAN, SPTF) run on requests all queued at t = 0, as in the interactive suite, and the
+// *_runs rows time the compressed (cylinder, count) elevators the way Runner drives them,
+// straight into a MetricsAccumulator. Every row runs in its own child process, so its
+// peak RSS is that case's high-water mark (input generation included) rather than the
+// suite's. With --compare it checks the run against a saved baseline CSV and exits
+// non-zero when any entry got slower than the threshold.
+//
+// Usage: ./Benchmark/benchSuite [--max-n N] [--reference-max N] [--timed-max N] [--cylinders N]
+//                               [--output FILE] [--compare BASELINE] [--threshold 0.10]
+#include "../Headers/DiskScheduling.h"
+#include "../Headers/SchedulerSinks.h"
+#include "../Headers/QueueGeneration.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// --- Allocation counting: every operator new in the process goes through here ---
+static std::atomic<size_t> allocationCount{0};
+static std::atomic<size_t> allocationBytes{0};
+
+void *operator new(size_t size)
+{
+    allocationCount++;
+    allocationBytes += size;
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+
+struct BenchRow
+{
+    std::string function;
+    std::string pattern;
+    long long n = 0;
+    long long reps = 0;
+    double nsPerRequest = 0.0;
+    double allocsPerCall = 0.0;
+    double allocBytesPerCall = 0.0;
+    long peakRssKb = 0;
+};
+
+// Repeats `fn` until at least ~20 ms have elapsed (and at least once), then averages
+static BenchRow measure(const std::string &function, const std::string &pattern, long long n, const std::function<void()> &fn)
+{
+    using clock = std::chrono::steady_clock;
+    BenchRow row;
+    row.function = function;
+    row.pattern = pattern;
+    row.n = n;
+    size_t countBefore = allocationCount, bytesBefore = allocationBytes;
+    auto begin = clock::now();
+    double elapsedNs = 0.0;
+    do
+    {
+        fn();
+        row.reps++;
+        elapsedNs = std::chrono::duration<double, std::nano>(clock::now() - begin).count();
+    } while (elapsedNs < 2e7 && row.reps < 1000000);
+    row.nsPerRequest = elapsedNs / (static_cast<double>(row.reps) * n);
+    row.allocsPerCall = static_cast<double>(allocationCount - countBefore) / row.reps;
+    row.allocBytesPerCall = static_cast<double>(allocationBytes - bytesBefore) / row.reps;
+    return row;
+}
+
+// One benchmarked function: `setup` builds its inputs from the queue, outside the timing,
+// and returns the call to time
+struct BenchCase
+{
+    std::string function;
+    long long maxN;
+    std::function<std::function<size_t()>(const std::vector<int> &queue)> setup;
+};
+
+static BenchRow runCase(const BenchCase &benchCase, QueuePattern pattern, long long n, int maxCylinder)
+{
+    std::mt19937 rng(static_cast<unsigned>(deriveSeed(42, n)));
+    std::vector<int> queue = generatePattern(pattern, maxCylinder, static_cast<int>(n), 8, rng);
+    std::function<size_t()> fn = benchCase.setup(queue);
+    volatile size_t sink = 0;
+    return measure(benchCase.function, patternName(pattern), n, [&]
+                   { sink += fn(); });
+}
+
+#ifdef _WIN32
+// No fork: cases share the process and peak RSS is not reported
+static bool runIsolated(const BenchCase &benchCase, QueuePattern pattern, long long n, int maxCylinder, BenchRow &row)
+{
+    row = runCase(benchCase, pattern, n, maxCylinder);
+    return true;
+}
+#else
+// Runs the case in a forked child, which sends back the timing through a pipe; wait4()
+// then gives that child's own peak RSS
+static bool runIsolated(const BenchCase &benchCase, QueuePattern pattern, long long n, int maxCylinder, BenchRow &row)
+{
+    struct Timing
+    {
+        long long reps;
+        double nsPerRequest, allocsPerCall, allocBytesPerCall;
+    };
+    int fds[2];
+    if (pipe(fds) != 0)
+        return false;
+    pid_t child = fork();
+    if (child < 0)
+    {
+        close(fds[0]);
+        close(fds[1]);
+        return false;
+    }
+    if (child == 0)
+    {
+        close(fds[0]);
+        BenchRow measured = runCase(benchCase, pattern, n, maxCylinder);
+        Timing timing{measured.reps, measured.nsPerRequest, measured.allocsPerCall, measured.allocBytesPerCall};
+        bool sent = write(fds[1], &timing, sizeof(timing)) == static_cast<ssize_t>(sizeof(timing));
+        _exit(sent ? 0 : 1);
+    }
+    close(fds[1]);
+    Timing timing;
+    bool received = read(fds[0], &timing, sizeof(timing)) == static_cast<ssize_t>(sizeof(timing));
+    close(fds[0]);
+    int status = 0;
+    rusage usage;
+    if (wait4(child, &status, 0, &usage) != child || !WIFEXITED(status) || WEXITSTATUS(status) != 0 || !received)
+        return false;
+
+    row.function = benchCase.function;
+    row.pattern = patternName(pattern);
+    row.n = n;
+    row.reps = timing.reps;
+    row.nsPerRequest = timing.nsPerRequest;
+    row.allocsPerCall = timing.allocsPerCall;
+    row.allocBytesPerCall = timing.allocBytesPerCall;
+#ifdef __APPLE__
+    row.peakRssKb = usage.ru_maxrss / 1024; // Bytes on macOS
+#else
+    row.peakRssKb = usage.ru_maxrss; // Kilobytes on Linux
+#endif
+    return true;
+}
+#endif
+
+static std::string rowKey(const std::string &function, const std::string &pattern, long long n)
+{
+    return function + "/" + pattern + "/" + std::to_string(n);
+}
+
+// Reads function,pattern,n,...,ns_per_request from a CSV written by this tool
+static std::map<std::string, double> loadBaseline(const std::string &path)
+{
+    std::map<std::string, double> baseline;
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line); // Header
+    while (std::getline(in, line))
+    {
+        std::stringstream ss(line);
+        std::string function, pattern, n, reps, ns;
+        if (std::getline(ss, function, ',') && std::getline(ss, pattern, ',') && std::getline(ss, n, ',') &&
+            std::getline(ss, reps, ',') && std::getline(ss, ns, ','))
+            baseline[rowKey(function, pattern, std::stoll(n))] = std::stod(ns);
+    }
+    return baseline;
+}
+
+int main(int argc, char *argv[])
+{
+    long long maxN = 10000000;
+    long long referenceMax = 10000; // O(n^2) reference implementations stop here
+    long long timedMax = 1000000;   // Arrival-aware schedulers, which track every request, stop here
+    int maxCylinder = 199999;
+    double threshold = 0.10;
+    std::string outputPath, comparePath;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        std::string arg = argv[i];
+        if (arg == "--max-n")
+            maxN = std::stoll(argv[i + 1]);
+        else if (arg == "--reference-max")
+            referenceMax = std::stoll(argv[i + 1]);
+        else if (arg == "--timed-max")
+            timedMax = std::stoll(argv[i + 1]);
+        else if (arg == "--cylinders")
+            maxCylinder = std::stoi(argv[i + 1]);
+        else if (arg == "--output")
+            outputPath = argv[i + 1];
+        else if (arg == "--compare")
+            comparePath = argv[i + 1];
+        else if (arg == "--threshold")
+            threshold = std::stod(argv[i + 1]);
+        else
+        {
+            std::cerr << "Unknown option " << arg << std::endl;
+            return 2;
+        }
+    }
+
+    const QueuePattern patterns[] = {QueuePattern::Uniform, QueuePattern::Sequential, QueuePattern::Clustered, QueuePattern::Mixed};
+    const int startHead = maxCylinder / 3;
+    const double requestSizeKB = 4.0;
+    DiskPerformanceParams diskParams;
+    FairSchedulingParams fairParams;
+
+    // Wraps a scheduler over the raw queue
+    auto onQueue = [&](const std::string &function, long long limit, std::function<size_t(const std::vector<int> &)> run)
+    {
+        return BenchCase{function, limit, [run](const std::vector<int> &queue)
+                         { return std::function<size_t()>([&queue, run]
+                                                          { return run(queue); }); }};
+    };
+    // Wraps an arrival-aware scheduler over requests all queued at t = 0
+    auto onRequests = [&](const std::string &function, std::function<size_t(const std::vector<Request> &)> run)
+    {
+        return BenchCase{function, timedMax, [=](const std::vector<int> &queue)
+                         {
+                             auto requests = std::make_shared<const std::vector<Request>>(makeRequests(queue, requestSizeKB));
+                             return std::function<size_t()>([requests, run]
+                                                            { return run(*requests); });
+                         }};
+    };
+    // Wraps a compressed elevator, fed into a MetricsAccumulator as in standardAlgorithmJobs
+    auto onRuns = [&](const std::string &function, std::function<void(const CompressedQueue &, MetricsAccumulator &)> run)
+    {
+        return BenchCase{function, maxN, [=](const std::vector<int> &queue)
+                         {
+                             auto runs = std::make_shared<const CompressedQueue>(compressQueue(queue));
+                             int n = static_cast<int>(queue.size());
+                             return std::function<size_t()>([=]
+                                                            {
+                                                                MetricsAccumulator accumulator(diskParams);
+                                                                run(*runs, accumulator);
+                                                                return static_cast<size_t>(accumulator.result(function, n).maxSeek);
+                                                            });
+                         }};
+    };
+
+    std::vector<BenchCase> cases = {
+        onQueue("fcfs", maxN, [&](const std::vector<int> &queue)
+                { return fcfs(startHead, queue).size(); }),
+        onQueue("sstf", maxN, [&](const std::vector<int> &queue)
+                { return sstf(startHead, queue).size(); }),
+        onQueue("scan", maxN, [&](const std::vector<int> &queue)
+                { return scan(startHead, maxCylinder, queue).size(); }),
+        onQueue("cscan", maxN, [&](const std::vector<int> &queue)
+                { return cscan(startHead, maxCylinder, queue).size(); }),
+        onQueue("look", maxN, [&](const std::vector<int> &queue)
+                { return look(startHead, queue).size(); }),
+        onQueue("clook", maxN, [&](const std::vector<int> &queue)
+                { return clook(startHead, queue).size(); }),
+        onQueue("hdsa", maxN, [&](const std::vector<int> &queue)
+                { return hdsa(startHead, queue).size(); }),
+        onQueue("prepareQueue", maxN, [&](const std::vector<int> &queue)
+                { return prepareQueue(startHead, queue).split; }),
+        onQueue("compressQueue", maxN, [&](const std::vector<int> &queue)
+                { return compressQueue(queue).cylinders.size(); }),
+        {"calculateMetrics", maxN, [&](const std::vector<int> &queue)
+         {
+             auto sequence = std::make_shared<const std::vector<int>>(sstf(startHead, queue));
+             int n = static_cast<int>(queue.size());
+             return std::function<size_t()>([=]
+                                            { return static_cast<size_t>(calculateMetrics("bench", *sequence, n, diskParams).maxSeek); });
+         }},
+        onRuns("scan_runs", [&](const CompressedQueue &runs, MetricsAccumulator &sink)
+               { scanTo(startHead, runs, maxCylinder, sink); }),
+        onRuns("cscan_runs", [&](const CompressedQueue &runs, MetricsAccumulator &sink)
+               { cscanTo(startHead, runs, maxCylinder, sink); }),
+        onRuns("look_runs", [&](const CompressedQueue &runs, MetricsAccumulator &sink)
+               { lookTo(startHead, runs, sink); }),
+        onRuns("clook_runs", [&](const CompressedQueue &runs, MetricsAccumulator &sink)
+               { clookTo(startHead, runs, sink); }),
+        onRuns("hdsa_runs", [&](const CompressedQueue &runs, MetricsAccumulator &sink)
+               { hdsaTo(startHead, runs, sink); }),
+        onRequests("mq_deadline", [&](const std::vector<Request> &requests)
+                   { return mq_deadline(startHead, requests, diskParams, fairParams).size(); }),
+        onRequests("fscan", [&](const std::vector<Request> &requests)
+                   { return fscan(startHead, requests, diskParams).size(); }),
+        onRequests("nstep_scan", [&](const std::vector<Request> &requests)
+                   { return nstep_scan(startHead, requests, diskParams, fairParams.nStep).size(); }),
+        onRequests("sptf", [&](const std::vector<Request> &requests)
+                   { return sptf(startHead, requests, diskParams).size(); }),
+        onQueue("sstf_reference", referenceMax, [&](const std::vector<int> &queue)
+                { return sstf_reference(startHead, queue).size(); }),
+        onQueue("hdsa_reference", referenceMax, [&](const std::vector<int> &queue)
+                { return hdsa_reference(startHead, queue).size(); }),
+    };
+
+    std::vector<BenchRow> rows;
+    for (QueuePattern pattern : patterns)
+    {
+        for (long long n = 10; n <= maxN; n *= 10)
+        {
+            for (const BenchCase &benchCase : cases)
+            {
+                if (n > benchCase.maxN)
+                    continue;
+                BenchRow row;
+                if (!runIsolated(benchCase, pattern, n, maxCylinder, row))
+                {
+                    std::cerr << "Error: " << benchCase.function << " " << patternName(pattern) << " n=" << n
+                              << " did not complete." << std::endl;
+                    return 2;
+                }
+                rows.push_back(row);
+                std::cerr << benchCase.function << " " << patternName(pattern) << " n=" << n << " done" << std::endl;
+            }
+        }
+    }
+
+    std::ofstream file;
+    if (!outputPath.empty())
+        file.open(outputPath);
+    std::ostream &out = outputPath.empty() ? std::cout : file;
+    out << "function,pattern,n,reps,ns_per_request,allocs_per_call,alloc_bytes_per_call,peak_rss_kb\n";
+    for (const BenchRow &row : rows)
+    {
+        out << row.function << "," << row.pattern << "," << row.n << "," << row.reps << ","
+            << std::fixed << std::setprecision(3) << row.nsPerRequest << "," << row.allocsPerCall << ","
+            << std::setprecision(0) << row.allocBytesPerCall << "," << row.peakRssKb << std::defaultfloat << "\n";
+    }
+
+    if (comparePath.empty())
+        return 0;
+    std::map<std::string, double> baseline = loadBaseline(comparePath);
+    if (baseline.empty())
+    {
+        std::cerr << "Error: no rows read from baseline '" << comparePath << "'." << std::endl;
+        return 2;
+    }
+    int regressions = 0;
+    for (const BenchRow &row : rows)
+    {
+        auto it = baseline.find(rowKey(row.function, row.pattern, row.n));
+        if (it == baseline.end() || it->second <= 0.0)
+            continue;
+        double change = row.nsPerRequest / it->second - 1.0;
+        if (change > threshold)
+        {
+            regressions++;
+            std::cerr << "REGRESSION " << rowKey(row.function, row.pattern, row.n) << ": "
+                      << std::fixed << std::setprecision(3) << it->second << " -> " << row.nsPerRequest
+                      << " ns/request (+" << std::setprecision(1) << change * 100.0 << "%)" << std::defaultfloat << std::endl;
+        }
+    }
+    std::cerr << regressions << " regression(s) against " << comparePath << " (threshold "
+              << threshold * 100.0 << "%)." << std::endl;
+    return regressions > 0 ? 1 : 0;
+}
@@ -0,0 +1,50 @@
+// HDSA scaling benchmark: sorted-frontier hdsa() against the O(n^2) hdsa_reference().
+// Usage: ./Benchmark/hdsaBench [maxRequests] [maxReferenceRequests]
+#include "../Headers/DiskScheduling.h"
+#include "../Headers/QueueGeneration.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <string>
+
+static double timeMs(std::vector<int> (*algo)(int, const std::vector<int> &), int startHead, const std::vector<int> &queue, size_t &outLength)
+{
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<int> sequence = algo(startHead, queue);
+    auto end = std::chrono::steady_clock::now();
+    outLength = sequence.size();
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+int main(int argc, char *argv[])
+{
+    long long maxRequests = (argc > 1) ? std::stoll(argv[1]) : 10000000;
+    long long maxReference = (argc > 2) ? std::stoll(argv[2]) : 32000;
+    const int maxCylinder = 199999;
+    const int startHead = maxCylinder / 3;
+    std::mt19937 rng(12345);
+
+    std::cout << "requests,hdsa_ms,hdsa_ns_per_req,reference_ms,match" << std::endl;
+    for (long long n = 1000; n <= maxRequests; n *= 10)
+    {
+        std::vector<int> queue = generateUniformRandom(maxCylinder, static_cast<int>(n), rng);
+        size_t fastLength = 0, refLength = 0;
+        double fastMs = timeMs(hdsa, startHead, queue, fastLength);
+
+        std::cout << n << "," << std::fixed << std::setprecision(3) << fastMs << ","
+                  << (fastMs * 1e6 / n) << ",";
+        if (n <= maxReference)
+        {
+            double refMs = timeMs(hdsa_reference, startHead, queue, refLength);
+            bool match = hdsa(startHead, queue) == hdsa_reference(startHead, queue);
+            std::cout << refMs << "," << (match ? "yes" : "NO");
+        }
+        else
+        {
+            std::cout << "skipped,-";
+        }
+        std::cout << std::defaultfloat << std::endl;
+    }
+    return 0;
+}
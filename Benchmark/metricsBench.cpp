@@ -0,0 +1,65 @@
+// Seek-metrics microbenchmark: scalar vs AVX2 kernel vs the streaming MetricsAccumulator,
+// in ns per element, with a bit-for-bit check of the kernels.
+// Usage: ./Benchmark/metricsBench [maxLength]
+#include "../Headers/DiskScheduling.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <string>
+
+template <typename Fn>
+static double nsPerElement(size_t length, Fn &&fn)
+{
+    auto begin = std::chrono::steady_clock::now();
+    fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - begin).count() / length;
+}
+
+static bool sameBits(const SeekStats &a, const SeekStats &b)
+{
+    return a.totalMovement == b.totalMovement && a.maxSeek == b.maxSeek && a.nonZeroSeeks == b.nonZeroSeeks &&
+           std::memcmp(&a.m2, &b.m2, sizeof(double)) == 0;
+}
+
+int main(int argc, char *argv[])
+{
+    long long maxLength = (argc > 1) ? std::stoll(argv[1]) : 100000000;
+    bool haveAvx2 = seekKernelAvailable(SeekKernel::AVX2);
+    DiskPerformanceParams diskParams;
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> cylinderDist(0, 199999);
+
+    std::cout << "length,scalar_ns,avx2_ns,accumulator_ns,bit_exact" << std::endl;
+    for (long long n = 1000000; n <= maxLength; n *= 10)
+    {
+        // Random head positions with about a quarter of zero-length seeks mixed in
+        std::vector<int> sequence(n);
+        sequence[0] = cylinderDist(rng);
+        for (long long i = 1; i < n; ++i)
+            sequence[i] = (rng() % 4 == 0) ? sequence[i - 1] : cylinderDist(rng);
+
+        SeekStats scalarStats, avx2Stats;
+        double scalarNs = nsPerElement(n, [&]
+                                       { scalarStats = computeSeekStats(sequence.data(), sequence.size(), SeekKernel::Scalar); });
+        double avx2Ns = 0.0;
+        if (haveAvx2)
+            avx2Ns = nsPerElement(n, [&]
+                                  { avx2Stats = computeSeekStats(sequence.data(), sequence.size(), SeekKernel::AVX2); });
+        MetricsAccumulator accumulator(diskParams);
+        double accumulatorNs = nsPerElement(n, [&]
+                                            { for (int c : sequence) accumulator.push(c); });
+        volatile int sink = accumulator.result("bench", static_cast<int>(n - 1)).maxSeek;
+        (void)sink;
+
+        std::cout << n << "," << std::fixed << std::setprecision(3) << scalarNs << ",";
+        if (haveAvx2)
+            std::cout << avx2Ns << "," << accumulatorNs << "," << (sameBits(scalarStats, avx2Stats) ? "yes" : "NO");
+        else
+            std::cout << "n/a," << accumulatorNs << ",n/a";
+        std::cout << std::defaultfloat << std::endl;
+    }
+    return 0;
+}
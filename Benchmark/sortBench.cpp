@@ -0,0 +1,70 @@
+// Cylinder sort benchmark: counting / LSD radix backends against std::sort on the four
+// QueueGeneration patterns. Usage: ./Benchmark/sortBench [maxRequests]
+#include "../Headers/DiskScheduling.h"
+#include "../Headers/QueueGeneration.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <string>
+
+static double timeSortMs(const std::vector<int> &queue, SortBackend backend, const std::vector<int> &expected)
+{
+    std::vector<int> work = queue;
+    auto begin = std::chrono::steady_clock::now();
+    sortCylinders(work, backend);
+    auto end = std::chrono::steady_clock::now();
+    if (work != expected)
+        std::cerr << "Error: backend produced unsorted output." << std::endl;
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+int main(int argc, char *argv[])
+{
+    long long maxRequests = (argc > 1) ? std::stoll(argv[1]) : 10000000;
+    const int maxCylinders[] = {4999, 199999};
+    const char *patterns[] = {"uniform", "sequential", "clustered", "mixed"};
+    std::mt19937 rng(12345);
+
+    std::cout << "pattern,max_cylinder,requests,auto_backend,std_sort_ms,counting_ms,radix_ms,auto_ms" << std::endl;
+    for (int maxCylinder : maxCylinders)
+    {
+        for (long long n = 100000; n <= maxRequests; n *= 10)
+        {
+            for (int p = 0; p < 4; ++p)
+            {
+                std::vector<int> queue;
+                switch (p)
+                {
+                case 0:
+                    queue = generateUniformRandom(maxCylinder, static_cast<int>(n), rng);
+                    break;
+                case 1:
+                    queue = generateSequential(maxCylinder, static_cast<int>(n), rng);
+                    break;
+                case 2:
+                    queue = generateClustered(maxCylinder, static_cast<int>(n), 8, rng);
+                    break;
+                default:
+                    queue = generateMixed(maxCylinder, static_cast<int>(n), rng);
+                    break;
+                }
+                std::vector<int> expected = queue;
+                std::sort(expected.begin(), expected.end());
+
+                auto [minIt, maxIt] = std::minmax_element(queue.begin(), queue.end());
+                SortBackend chosen = chooseSortBackend(queue.size(), static_cast<long long>(*maxIt) - *minIt + 1);
+                const char *chosenName = chosen == SortBackend::Counting ? "counting" : (chosen == SortBackend::Radix ? "radix" : "std::sort");
+
+                std::cout << patterns[p] << "," << maxCylinder << "," << n << "," << chosenName << ","
+                          << std::fixed << std::setprecision(3)
+                          << timeSortMs(queue, SortBackend::Comparison, expected) << ","
+                          << timeSortMs(queue, SortBackend::Counting, expected) << ","
+                          << timeSortMs(queue, SortBackend::Radix, expected) << ","
+                          << timeSortMs(queue, SortBackend::Auto, expected)
+                          << std::defaultfloat << std::endl;
+            }
+        }
+    }
+    return 0;
+}
@@ -1,120 +1,175 @@
 #include "../Headers/DiskScheduling.h"
 #include <cmath>
 #include <limits>
-AlgorithmResult calculateMetrics(const std::string &name,
-                                 const std::vector<int> &sequence,
-                                 int numRequests,
-                                 const DiskPerformanceParams &diskParams) // Pass disk params
+
+DiskPerformanceParams deriveDiskParams(double seekTimePerCylinderMs, double rpm, double transferRateMBps, double avgRequestSizeKB)
 {
-    AlgorithmResult result;
-    result.name = name;
-    result.seekSequence = sequence;
+    DiskPerformanceParams diskParams;
+    diskParams.avgSeekTimePerCylinderMs = seekTimePerCylinderMs;
+    diskParams.avgRotationalLatencyMs = (rpm > 0) ? (30000.0 / rpm) : 0.0; // (60 * 1000 / RPM) / 2
+    double transferRateKBpms = (transferRateMBps * 1024.0) / 1000.0;       // MB/s -> KB/s -> KB/ms
+    diskParams.transferTimePerRequestMs = (transferRateKBpms > 0) ? (avgRequestSizeKB / transferRateKBpms) : 0.0;
+    diskParams.transferRateKBpms = transferRateKBpms;
+    return diskParams;
+}
 
-    // Handle cases with no requests or only the start head
-    if (sequence.size() < 2 || numRequests == 0)
+DiskGeometry makeDiskGeometry(int sectorsPerTrack, double rpm)
+{
+    DiskGeometry geometry;
+    geometry.sectorsPerTrack = std::max(0, sectorsPerTrack);
+    geometry.revolutionMs = (rpm > 0) ? (60000.0 / rpm) : 0.0;
+    return geometry;
+}
+
+MetricsAccumulator::MetricsAccumulator(const DiskPerformanceParams &diskParams, const MetricsOptions &options)
+    : params(diskParams), collectPercentiles(options.collectPercentiles)
+{
+}
+
+void MetricsAccumulator::push(int cylinder)
+{
+    if (!started)
     {
-        if (numRequests > 0 && sequence.size() == 1)
-        { // Only start head, no requests to service *from* there
-            result.totalMovement = 0;
-            result.avgSeek = 0.0;
-            result.maxSeek = 0;
-            result.stdDevSeek = 0.0;
-            result.throughput = 0.0;      // No requests completed
-            result.avgResponseTime = 0.0; // No service occurred
-        }
-        else if (numRequests == 0)
-        {
-            // No requests, metrics are zero or undefined
-        }
-        return result;
+        started = true;
+        currentHead = cylinder;
+        return;
     }
+    int seekDistance = std::abs(cylinder - currentHead);
+    currentHead = cylinder;
+    steps++;
+    totalMovement += seekDistance;
 
-    std::vector<int> seekTimesDistances; // Store distances for StdDev Seek
-    int currentMaxSeekDistance = 0;
-    long long currentTotalMovement = 0;
-    double totalServiceTimeMs = 0.0; // Accumulator for response time components
+    // --- Calculate time components for this specific seek/service ---
+    double seekTimeMs = params.seekTimeMs(seekDistance);
+    double serviceTimeMs = seekTimeMs + params.avgRotationalLatencyMs + params.transferTimePerRequestMs;
+    totalServiceTimeMs += serviceTimeMs;
+    if (collectPercentiles)
+    {
+        seekHistogram.record(seekDistance);
+        serviceHistogram.record(static_cast<unsigned long long>(std::llround(serviceTimeMs * 1000.0)));
+    }
 
-    // Iterate through the movements required to service the requests
-    for (size_t i = 1; i < sequence.size(); ++i)
+    if (seekDistance > maxSeek)
+        maxSeek = seekDistance;
+    // StdDev Seek only looks at actual movements (non-zero distances)
+    if (seekDistance > 0)
     {
-        int seekDistance = std::abs(sequence[i] - sequence[i - 1]);
-        currentTotalMovement += seekDistance;
-
-        // --- Calculate time components for this specific seek/service ---
-        double seekTimeMs = static_cast<double>(seekDistance) * diskParams.avgSeekTimePerCylinderMs;
-        double serviceTimeForThisStepMs = seekTimeMs + diskParams.avgRotationalLatencyMs + diskParams.transferTimePerRequestMs;
-        totalServiceTimeMs += serviceTimeForThisStepMs;
-
-        // --- Store data for other metrics ---
-        if (seekDistance > 0)
-        {
-            seekTimesDistances.push_back(seekDistance); // Store distance for StdDev Seek
-        }
-        if (seekDistance > currentMaxSeekDistance)
-        {
-            currentMaxSeekDistance = seekDistance;
-        }
+        nonZeroSeeks++;
+        double delta = seekDistance - meanSeek;
+        meanSeek += delta / nonZeroSeeks;
+        m2Seek += delta * (seekDistance - meanSeek);
     }
-    // Add a zero seek distance if needed for StdDev calculation when no movement occurred
-    if (currentTotalMovement == 0 && sequence.size() > 1)
+}
+
+void MetricsAccumulator::pushRun(int cylinder, long long count)
+{
+    if (count <= 0)
+        return;
+    push(cylinder);
+    long long repeats = count - 1;
+    if (repeats == 0)
+        return;
+    // The repeats add steps and service time but no movement, and do not touch the
+    // max or the non-zero seek statistics
+    double serviceTimeMs = params.seekTimeMs(0) + params.avgRotationalLatencyMs + params.transferTimePerRequestMs;
+    steps += repeats;
+    totalServiceTimeMs += serviceTimeMs * repeats;
+    if (collectPercentiles)
     {
-        seekTimesDistances.push_back(0);
+        seekHistogram.record(0, repeats);
+        serviceHistogram.record(static_cast<unsigned long long>(std::llround(serviceTimeMs * 1000.0)), repeats);
     }
+}
+
+// Shared tail of both metric paths: derive the per-request figures from the totals
+static AlgorithmResult buildResult(const std::string &name, int numRequests, long long steps,
+                                   long long totalMovement, int maxSeek, double stdDevSeek,
+                                   double totalServiceTimeMs)
+{
+    AlgorithmResult result;
+    result.name = name;
+
+    // Handle cases with no requests or only the start head: metrics stay zero
+    if (steps == 0 || numRequests == 0)
+        return result;
 
     // --- Assign calculated metrics ---
-    result.totalMovement = static_cast<int>(currentTotalMovement);
-    result.maxSeek = currentMaxSeekDistance; // Max seek is based on distance
+    result.totalMovement = totalMovement;
+    result.maxSeek = maxSeek; // Max seek is based on distance
+
+    // Avg Seek Time (distance per request)
+    result.avgSeek = static_cast<double>(result.totalMovement) / numRequests;
 
-    if (numRequests > 0)
+    // Std Dev Seek (population, over non-zero distances; zero when the head never moved)
+    result.stdDevSeek = stdDevSeek;
+
+    // Throughput (requests per unit of movement)
+    if (result.totalMovement > 0)
+    {
+        result.throughput = static_cast<double>(numRequests) / result.totalMovement;
+    }
+    else
+    {
+        // All requests were at the start head; throughput relative to movement is unbounded.
+        result.throughput = std::numeric_limits<double>::infinity();
+    }
+
+    // Average Response Time (ms per service step)
+    result.avgResponseTime = totalServiceTimeMs / steps;
+    return result;
+}
+
+AlgorithmResult MetricsAccumulator::result(const std::string &name, int numRequests) const
+{
+    double stdDevSeek = (nonZeroSeeks > 0) ? std::sqrt(m2Seek / nonZeroSeeks) : 0.0;
+    AlgorithmResult result = buildResult(name, numRequests, steps, totalMovement, maxSeek, stdDevSeek, totalServiceTimeMs);
+    if (collectPercentiles)
     {
-        // Avg Seek Time (distance per request)
-        result.avgSeek = static_cast<double>(result.totalMovement) / numRequests;
-
-        // Std Dev Seek (based on distances)
-        if (!seekTimesDistances.empty())
-        {
-            double sumSqDiff = 0.0;
-            double avgActualSeekDistance = static_cast<double>(currentTotalMovement) / seekTimesDistances.size();
-            for (int dist : seekTimesDistances)
-            {
-                sumSqDiff += std::pow(static_cast<double>(dist) - avgActualSeekDistance, 2);
-            }
-            double variance = sumSqDiff / seekTimesDistances.size();
-            result.stdDevSeek = std::sqrt(variance);
-        }
-        else
-        {
-            result.stdDevSeek = 0.0;
-        }
-
-        // Throughput (requests per unit of movement)
-        if (result.totalMovement > 0)
-        {
-            result.throughput = static_cast<double>(numRequests) / result.totalMovement;
-        }
-        else
-        { // Movement is 0
-            // If numRequests > 0 and movement is 0, all requests were at start head?
-            // Throughput could be considered infinite relative to movement, but maybe better as 0?
-            // Let's keep Inf for consistency, but acknowledge ambiguity.
-            result.throughput = (numRequests > 0) ? std::numeric_limits<double>::infinity() : 0.0;
-        }
-
-        // Average Response Time (ms per request)
-        // Check sequence size > 1 because service time is calculated per *step*
-        int numServiceSteps = sequence.size() - 1;
-        if (numServiceSteps > 0)
-        {
-            // Average the total time over the number of service steps performed.
-            // This implicitly averages over the number of requests if seq_size-1 == numRequests
-            result.avgResponseTime = totalServiceTimeMs / numServiceSteps;
-        }
-        else
-        {
-            result.avgResponseTime = 0.0; // No service steps occurred
-        }
-
-    } // End if (numRequests > 0)
+        result.hasPercentiles = true;
+        result.seekHistogram = seekHistogram;
+        result.serviceHistogram = serviceHistogram;
+        result.seekPercentiles = summarizeHistogram(seekHistogram);
+        result.servicePercentiles = summarizeHistogram(serviceHistogram, 0.001);
+    }
+    return result;
+}
+
+AlgorithmResult metricsFromSeekStats(const std::string &name, int numRequests, long long steps, const SeekStats &stats,
+                                     double totalServiceTimeMs)
+{
+    double stdDevSeek = (stats.nonZeroSeeks > 0) ? std::sqrt(stats.m2 / stats.nonZeroSeeks) : 0.0;
+    return buildResult(name, numRequests, steps, stats.totalMovement, stats.maxSeek, stdDevSeek, totalServiceTimeMs);
+}
+
+AlgorithmResult calculateMetrics(const std::string &name,
+                                 const std::vector<int> &sequence,
+                                 int numRequests,
+                                 const DiskPerformanceParams &diskParams, // Pass disk params
+                                 const MetricsOptions &options)
+{
+    // Histograms and non-linear seek curves need every step individually, so they go through
+    // the streaming path
+    if (options.collectPercentiles || diskParams.seekCurve)
+    {
+        MetricsAccumulator accumulator(diskParams, options);
+        for (int cylinder : sequence)
+            accumulator.push(cylinder);
+        AlgorithmResult result = accumulator.result(name, numRequests);
+        if (options.storeSequence)
+            result.seekSequence = sequence;
+        return result;
+    }
+
+    // Whole sequence is in memory, so use the vectorized kernel instead of the streaming path
+    SeekStats stats = computeSeekStats(sequence.data(), sequence.size());
+    long long steps = sequence.empty() ? 0 : static_cast<long long>(sequence.size()) - 1;
+
+    // Every step pays its seek plus the fixed rotational latency and transfer time
+    double totalServiceTimeMs = static_cast<double>(stats.totalMovement) * diskParams.avgSeekTimePerCylinderMs +
+                                steps * (diskParams.avgRotationalLatencyMs + diskParams.transferTimePerRequestMs);
 
+    AlgorithmResult result = metricsFromSeekStats(name, numRequests, steps, stats, totalServiceTimeMs);
+    if (options.storeSequence)
+        result.seekSequence = sequence;
     return result;
-}
\ No newline at end of file
+}
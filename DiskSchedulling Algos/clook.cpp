@@ -1,32 +1,16 @@
+#include "../Headers/DiskScheduling.h"
+#include "../Headers/SchedulerSinks.h"
 #include <vector>
-std::vector<int> clook(int startHead, const std::vector<int> &requests)
+std::vector<int> clook(const PreparedQueue &prepared)
 {
     std::vector<int> sequence;
-    sequence.push_back(startHead);
-    if (requests.empty())
-        return sequence;
-
-    std::vector<int> remaining = requests;
-    std::sort(remaining.begin(), remaining.end());
-    std::vector<int> lower, upper;
-    for (int req : remaining)
-    {
-        if (req < startHead)
-            lower.push_back(req);
-        else
-            upper.push_back(req);
-    }
-
-    for (int req : upper)
-    {
-        sequence.push_back(req);
-    }
-    if (!lower.empty())
-    {
-        for (int req : lower)
-        {
-            sequence.push_back(req);
-        }
-    }
+    sequence.reserve(prepared.sorted.size() + 1);
+    VectorSink sink{sequence};
+    clookTo(prepared, sink);
     return sequence;
-}
\ No newline at end of file
+}
+
+std::vector<int> clook(int startHead, const std::vector<int> &requests)
+{
+    return clook(prepareQueue(startHead, requests));
+}
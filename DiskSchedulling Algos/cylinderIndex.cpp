@@ -0,0 +1,161 @@
+#include "../Headers/CylinderIndex.h"
+#include <algorithm>
+
+static const uint8_t countSpilled = 255;
+
+CylinderIndex::CylinderIndex(int maxCylinder) : lastCylinder(std::max(0, maxCylinder))
+{
+    size_t bits = static_cast<size_t>(lastCylinder) + 1;
+    do
+    {
+        size_t words = (bits + 63) / 64;
+        levels.emplace_back(words, 0);
+        bits = words;
+    } while (bits > 1);
+    counts.assign(static_cast<size_t>(lastCylinder) + 1, 0);
+}
+
+void CylinderIndex::setBit(int cylinder)
+{
+    size_t index = cylinder;
+    for (std::vector<uint64_t> &level : levels)
+    {
+        uint64_t &word = level[index >> 6];
+        bool wasEmpty = (word == 0);
+        word |= 1ull << (index & 63);
+        if (!wasEmpty)
+            return; // Upper levels already mark this word
+        index >>= 6;
+    }
+}
+
+void CylinderIndex::clearBit(int cylinder)
+{
+    size_t index = cylinder;
+    for (std::vector<uint64_t> &level : levels)
+    {
+        uint64_t &word = level[index >> 6];
+        word &= ~(1ull << (index & 63));
+        if (word != 0)
+            return; // Word still occupied, upper levels unchanged
+        index >>= 6;
+    }
+}
+
+void CylinderIndex::insert(int cylinder)
+{
+    uint8_t &c = counts[cylinder];
+    if (c == 0)
+        setBit(cylinder);
+    if (c < countSpilled - 1)
+        c++;
+    else if (c == countSpilled - 1)
+    {
+        c = countSpilled;
+        overflow[cylinder] = countSpilled;
+    }
+    else
+        overflow[cylinder]++;
+    totalCount++;
+}
+
+bool CylinderIndex::remove(int cylinder)
+{
+    uint8_t &c = counts[cylinder];
+    if (c == 0)
+        return false;
+    if (c == countSpilled)
+    {
+        auto it = overflow.find(cylinder);
+        if (--it->second < countSpilled)
+        {
+            c = static_cast<uint8_t>(it->second);
+            overflow.erase(it);
+        }
+    }
+    else if (--c == 0)
+        clearBit(cylinder);
+    totalCount--;
+    return true;
+}
+
+uint32_t CylinderIndex::count(int cylinder) const
+{
+    uint8_t c = counts[cylinder];
+    return c == countSpilled ? overflow.at(cylinder) : c;
+}
+
+int CylinderIndex::nextAtOrAbove(int cylinder) const
+{
+    if (cylinder < 0)
+        cylinder = 0;
+    if (cylinder > lastCylinder || totalCount == 0)
+        return -1;
+
+    // Climb until some word has a set bit at or after the current position
+    size_t index = cylinder;
+    size_t level = 0;
+    while (true)
+    {
+        const std::vector<uint64_t> &words = levels[level];
+        size_t w = index >> 6;
+        uint64_t masked = (w < words.size()) ? words[w] & (~0ull << (index & 63)) : 0;
+        if (masked != 0)
+        {
+            index = (w << 6) | __builtin_ctzll(masked);
+            break;
+        }
+        if (level + 1 == levels.size())
+            return -1;
+        index = w + 1; // Continue strictly after this word one level up
+        level++;
+    }
+    // Descend to the lowest set bit under that position
+    while (level > 0)
+    {
+        level--;
+        index = (index << 6) | __builtin_ctzll(levels[level][index]);
+    }
+    return static_cast<int>(index);
+}
+
+int CylinderIndex::prevAtOrBelow(int cylinder) const
+{
+    if (cylinder < 0 || totalCount == 0)
+        return -1;
+    if (cylinder > lastCylinder)
+        cylinder = lastCylinder;
+
+    long long index = cylinder;
+    size_t level = 0;
+    while (true)
+    {
+        const std::vector<uint64_t> &words = levels[level];
+        size_t w = static_cast<size_t>(index) >> 6;
+        int bit = static_cast<int>(index & 63);
+        uint64_t masked = words[w] & (bit == 63 ? ~0ull : ((2ull << bit) - 1));
+        if (masked != 0)
+        {
+            index = static_cast<long long>(w << 6) | (63 - __builtin_clzll(masked));
+            break;
+        }
+        if (level + 1 == levels.size() || w == 0)
+            return -1;
+        index = static_cast<long long>(w) - 1; // Continue strictly before this word one level up
+        level++;
+    }
+    while (level > 0)
+    {
+        level--;
+        index = (index << 6) | (63 - __builtin_clzll(levels[level][index]));
+    }
+    return static_cast<int>(index);
+}
+
+size_t CylinderIndex::memoryBytes() const
+{
+    size_t bytes = counts.size() * sizeof(uint8_t);
+    for (const std::vector<uint64_t> &level : levels)
+        bytes += level.size() * sizeof(uint64_t);
+    return bytes + overflow.size() * (sizeof(int) + sizeof(uint32_t) + 2 * sizeof(void *));
+}
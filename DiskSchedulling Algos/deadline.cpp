@@ -0,0 +1,13 @@
+#include "../Headers/DiskScheduling.h"
+#include "../Headers/SchedulerSinks.h"
+#include <vector>
+
+std::vector<int> mq_deadline(int startHead, const std::vector<Request> &requests, const DiskPerformanceParams &diskParams,
+                             const FairSchedulingParams &fairParams)
+{
+    std::vector<int> sequence;
+    sequence.reserve(requests.size() + 1);
+    VectorSink sink{sequence};
+    mqDeadlineTo(startHead, requests, diskParams, fairParams, sink);
+    return sequence;
+}
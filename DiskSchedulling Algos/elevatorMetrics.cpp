@@ -0,0 +1,215 @@
+#include "../Headers/DiskScheduling.h"
+#include <vector>
+
+const char *elevatorName(ElevatorAlgorithm algorithm)
+{
+    switch (algorithm)
+    {
+    case ElevatorAlgorithm::Scan:
+        return "SCAN";
+    case ElevatorAlgorithm::CScan:
+        return "C-SCAN";
+    case ElevatorAlgorithm::Look:
+        return "LOOK";
+    default:
+        return "C-LOOK";
+    }
+}
+
+ElevatorProfile::ElevatorProfile(const CompressedQueue &queue, const DiskPerformanceParams &diskParams)
+    : cylinders(queue.cylinders), requestCount(static_cast<long long>(queue.requestCount)), params(diskParams)
+{
+    // Gap i lies between cylinders i and i + 1
+    size_t numGaps = cylinders.empty() ? 0 : cylinders.size() - 1;
+    gapSum.assign(numGaps + 1, 0);
+    gapSquares.assign(numGaps + 1, 0);
+    prefixMax.assign(numGaps + 1, 0);
+    suffixMax.assign(numGaps + 1, 0);
+    if (params.seekCurve)
+        gapSeekMs.assign(numGaps + 1, 0.0);
+    for (size_t i = 0; i < numGaps; ++i)
+    {
+        long long gap = static_cast<long long>(cylinders[i + 1]) - cylinders[i];
+        gapSum[i + 1] = gapSum[i] + gap;
+        gapSquares[i + 1] = gapSquares[i] + gap * gap;
+        prefixMax[i + 1] = std::max(prefixMax[i], static_cast<int>(gap));
+        if (params.seekCurve)
+            gapSeekMs[i + 1] = gapSeekMs[i] + params.seekTimeMs(gap);
+    }
+    for (size_t i = numGaps; i > 0; --i)
+        suffixMax[i - 1] = std::max(suffixMax[i], cylinders[i] - cylinders[i - 1]);
+}
+
+namespace
+{
+    // Adds moves and gap ranges to a running total
+    struct TotalsBuilder
+    {
+        ElevatorTotals totals;
+        long long squares = 0;
+        const DiskPerformanceParams &params;
+
+        void move(long long distance)
+        {
+            distance = std::abs(distance);
+            totals.steps++;
+            totals.seeks.totalMovement += distance;
+            totals.seeks.maxSeek = std::max(totals.seeks.maxSeek, static_cast<int>(distance));
+            if (distance > 0)
+            {
+                totals.seeks.nonZeroSeeks++;
+                squares += distance * distance;
+            }
+            if (params.seekCurve)
+                totals.totalSeekTimeMs += params.seekTimeMs(distance);
+        }
+    };
+
+    // Sum of squared deviations from the mean, (n * sum(d^2) - sum(d)^2) / n, with the
+    // numerator formed exactly in integers so nothing cancels in floating point
+    double squaredDeviations(long long squares, long long total, long long n)
+    {
+        if (n == 0)
+            return 0.0;
+#ifdef __SIZEOF_INT128__
+        __int128 numerator = static_cast<__int128>(n) * squares - static_cast<__int128>(total) * total;
+        return static_cast<double>(numerator) / n;
+#else
+        long double numerator = static_cast<long double>(n) * squares - static_cast<long double>(total) * total;
+        return static_cast<double>(numerator / n);
+#endif
+    }
+}
+
+ElevatorTotals ElevatorProfile::totalsAt(ElevatorAlgorithm algorithm, int startHead, size_t split, int maxCylinder) const
+{
+    TotalsBuilder builder{ElevatorTotals(), 0, params};
+    size_t m = cylinders.size();
+    if (m == 0)
+        return builder.totals;
+
+    // Sweep over the cylinders [first, last), in either direction: its gaps are first .. last - 2
+    auto sweep = [&](size_t first, size_t last)
+    {
+        if (last - first < 2)
+            return;
+        size_t a = first, b = last - 1;
+        builder.totals.steps += b - a;
+        builder.totals.seeks.totalMovement += gapSum[b] - gapSum[a];
+        builder.totals.seeks.nonZeroSeeks += b - a; // Distinct cylinders, so every gap is > 0
+        builder.squares += gapSquares[b] - gapSquares[a];
+        // Sweeps only ever cover a prefix or a suffix of the cylinders
+        int widest = (a == 0) ? prefixMax[b] : suffixMax[a];
+        builder.totals.seeks.maxSeek = std::max(builder.totals.seeks.maxSeek, widest);
+        if (params.seekCurve)
+            builder.totals.totalSeekTimeMs += gapSeekMs[b] - gapSeekMs[a];
+    };
+
+    bool hasLower = split > 0, hasUpper = split < m;
+    long long current = startHead;
+    switch (algorithm)
+    {
+    case ElevatorAlgorithm::Scan:
+        // Down through the lower requests to cylinder 0, then up through the rest
+        if (hasLower)
+        {
+            builder.move(current - cylinders[split - 1]);
+            sweep(0, split);
+            current = cylinders.front();
+        }
+        if (current != 0)
+        {
+            builder.move(current);
+            current = 0;
+        }
+        if (hasUpper)
+        {
+            builder.move(cylinders[split] - current);
+            sweep(split, m);
+        }
+        break;
+    case ElevatorAlgorithm::CScan:
+        // Up to maxCylinder, jump to 0, up through the lower requests
+        if (hasUpper)
+        {
+            builder.move(cylinders[split] - current);
+            sweep(split, m);
+            current = cylinders.back();
+        }
+        if (current != maxCylinder)
+        {
+            builder.move(maxCylinder - current);
+            current = maxCylinder;
+        }
+        if (hasLower)
+        {
+            builder.move(current);
+            builder.move(cylinders.front());
+            sweep(0, split);
+        }
+        break;
+    case ElevatorAlgorithm::Look:
+    case ElevatorAlgorithm::CLook:
+        if (hasUpper)
+        {
+            builder.move(cylinders[split] - current);
+            sweep(split, m);
+            current = cylinders.back();
+        }
+        if (hasLower)
+        {
+            // LOOK turns round at the last upper request, C-LOOK jumps to the lowest one
+            builder.move(current - (algorithm == ElevatorAlgorithm::Look ? cylinders[split - 1] : cylinders.front()));
+            sweep(0, split);
+        }
+        break;
+    }
+
+    // Every duplicate of a cylinder is serviced straight after it, at distance 0
+    long long duplicates = requestCount - static_cast<long long>(m);
+    builder.totals.steps += duplicates;
+    if (params.seekCurve)
+        builder.totals.totalSeekTimeMs += duplicates * params.seekTimeMs(0);
+    else
+        builder.totals.totalSeekTimeMs = builder.totals.seeks.totalMovement * params.avgSeekTimePerCylinderMs;
+    builder.totals.seeks.m2 = squaredDeviations(builder.squares, builder.totals.seeks.totalMovement,
+                                                builder.totals.seeks.nonZeroSeeks);
+    return builder.totals;
+}
+
+ElevatorTotals ElevatorProfile::totals(ElevatorAlgorithm algorithm, int startHead, int maxCylinder) const
+{
+    size_t split = std::lower_bound(cylinders.begin(), cylinders.end(), startHead) - cylinders.begin();
+    return totalsAt(algorithm, startHead, split, maxCylinder);
+}
+
+AlgorithmResult ElevatorProfile::result(ElevatorAlgorithm algorithm, const ElevatorTotals &totals) const
+{
+    double totalServiceTimeMs = totals.totalSeekTimeMs +
+                                totals.steps * (params.avgRotationalLatencyMs + params.transferTimePerRequestMs);
+    return metricsFromSeekStats(elevatorName(algorithm), static_cast<int>(requestCount), totals.steps, totals.seeks,
+                                totalServiceTimeMs);
+}
+
+AlgorithmResult ElevatorProfile::evaluate(ElevatorAlgorithm algorithm, int startHead, int maxCylinder) const
+{
+    return result(algorithm, totals(algorithm, startHead, maxCylinder));
+}
+
+std::vector<ElevatorTotals> ElevatorProfile::sweepHeads(ElevatorAlgorithm algorithm, int maxCylinder, int step) const
+{
+    std::vector<ElevatorTotals> sweep;
+    step = std::max(1, step);
+    if (maxCylinder < 0)
+        return sweep;
+    sweep.reserve(static_cast<size_t>(maxCylinder) / step + 1);
+    // Heads only increase, so the split point only moves forward
+    size_t split = 0;
+    for (long long head = 0; head <= maxCylinder; head += step)
+    {
+        while (split < cylinders.size() && cylinders[split] < head)
+            split++;
+        sweep.push_back(totalsAt(algorithm, static_cast<int>(head), split, maxCylinder));
+    }
+    return sweep;
+}
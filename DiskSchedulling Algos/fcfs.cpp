@@ -1,13 +1,13 @@
 
+#include "../Headers/DiskScheduling.h"
+#include "../Headers/SchedulerSinks.h"
 #include <vector>
 // FCFS: First-Come, First-Served
 std::vector<int> fcfs(int startHead, const std::vector<int> &requests)
 {
     std::vector<int> sequence;
-    sequence.push_back(startHead);
-    for (int req : requests)
-    {
-        sequence.push_back(req);
-    }
+    sequence.reserve(requests.size() + 1);
+    VectorSink sink{sequence};
+    fcfsTo(startHead, requests, sink);
     return sequence;
-}
\ No newline at end of file
+}
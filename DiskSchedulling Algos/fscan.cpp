@@ -0,0 +1,21 @@
+#include "../Headers/DiskScheduling.h"
+#include "../Headers/SchedulerSinks.h"
+#include <vector>
+
+std::vector<int> fscan(int startHead, const std::vector<Request> &requests, const DiskPerformanceParams &diskParams)
+{
+    std::vector<int> sequence;
+    sequence.reserve(requests.size() + 1);
+    VectorSink sink{sequence};
+    fscanTo(startHead, requests, diskParams, sink);
+    return sequence;
+}
+
+std::vector<int> nstep_scan(int startHead, const std::vector<Request> &requests, const DiskPerformanceParams &diskParams, int nStep)
+{
+    std::vector<int> sequence;
+    sequence.reserve(requests.size() + 1);
+    VectorSink sink{sequence};
+    nstepScanTo(startHead, requests, diskParams, nStep, sink);
+    return sequence;
+}
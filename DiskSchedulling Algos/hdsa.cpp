@@ -1,3 +1,5 @@
+#include "../Headers/DiskScheduling.h"
+#include "../Headers/SchedulerSinks.h"
 #include <vector>
 // Helper function to perform SSTF on a given queue subset
 int run_sstf_subset(int currentHead, std::vector<int> &queue_subset, std::vector<int> &overall_sequence)
@@ -28,8 +30,8 @@ int run_sstf_subset(int currentHead, std::vector<int> &queue_subset, std::vector
     }
     return currentHead;
 }
-// HDSA: Hybrid Disk Scheduling Algorithm
-std::vector<int> hdsa(int startHead, const std::vector<int> &requests)
+// HDSA: Hybrid Disk Scheduling Algorithm (reference, O(n^2) through run_sstf_subset)
+std::vector<int> hdsa_reference(int startHead, const std::vector<int> &requests)
 {
     std::vector<int> sequence;
     sequence.push_back(startHead);
@@ -64,4 +66,18 @@ std::vector<int> hdsa(int startHead, const std::vector<int> &requests)
         currentHead = run_sstf_subset(currentHead, Q, sequence);
     }
     return sequence;
-}
\ No newline at end of file
+}
+
+std::vector<int> hdsa(const PreparedQueue &prepared)
+{
+    std::vector<int> sequence;
+    sequence.reserve(prepared.sorted.size() + 1);
+    VectorSink sink{sequence};
+    hdsaTo(prepared, sink);
+    return sequence;
+}
+
+std::vector<int> hdsa(int startHead, const std::vector<int> &requests)
+{
+    return hdsa(prepareQueue(startHead, requests));
+}
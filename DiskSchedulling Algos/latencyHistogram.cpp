@@ -0,0 +1,74 @@
+#include "../Headers/DiskScheduling.h"
+#include <vector>
+
+// Values below 64 map to themselves; above that, the top 6 significant bits pick one of
+// 32 sub-buckets within each power of two.
+int LatencyHistogram::bucketIndex(unsigned long long value)
+{
+    if (value < 64)
+        return static_cast<int>(value);
+    int exponent = 63 - __builtin_clzll(value); // >= 6
+    int subBucket = static_cast<int>((value >> (exponent - subBucketBits)) & 31);
+    return 64 + (exponent - 6) * 32 + subBucket;
+}
+
+unsigned long long LatencyHistogram::bucketUpperBound(int index)
+{
+    if (index < 64)
+        return index;
+    int exponent = (index - 64) / 32 + 6;
+    unsigned long long subBucket = (index - 64) % 32 + 32; // Restore the leading bit
+    int shift = exponent - subBucketBits;
+    return ((subBucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(unsigned long long value, unsigned long long count)
+{
+    if (count == 0)
+        return;
+    if (counts.empty())
+        counts.assign(numBuckets, 0);
+    counts[bucketIndex(value)] += count;
+    total += count;
+    maxRecorded = std::max(maxRecorded, value);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other)
+{
+    if (other.total == 0)
+        return;
+    if (counts.empty())
+        counts.assign(numBuckets, 0);
+    for (int i = 0; i < numBuckets; ++i)
+        counts[i] += other.counts[i];
+    total += other.total;
+    maxRecorded = std::max(maxRecorded, other.maxRecorded);
+}
+
+unsigned long long LatencyHistogram::valueAtPercentile(double percentile) const
+{
+    if (total == 0)
+        return 0;
+    percentile = std::min(100.0, std::max(0.0, percentile));
+    unsigned long long rank = static_cast<unsigned long long>(std::ceil(percentile / 100.0 * total));
+    rank = std::max(1ull, rank);
+    unsigned long long seen = 0;
+    for (int i = 0; i < numBuckets; ++i)
+    {
+        seen += counts[i];
+        if (seen >= rank)
+            return std::min(bucketUpperBound(i), maxRecorded);
+    }
+    return maxRecorded;
+}
+
+PercentileSummary summarizeHistogram(const LatencyHistogram &histogram, double scale)
+{
+    PercentileSummary summary;
+    summary.p50 = histogram.valueAtPercentile(50.0) * scale;
+    summary.p90 = histogram.valueAtPercentile(90.0) * scale;
+    summary.p99 = histogram.valueAtPercentile(99.0) * scale;
+    summary.p999 = histogram.valueAtPercentile(99.9) * scale;
+    summary.max = histogram.maxValue() * scale;
+    return summary;
+}
@@ -0,0 +1,33 @@
+#include "../Headers/DiskScheduling.h"
+#include <vector>
+// Sort the queue once and record where startHead splits it; shared by the elevator algorithms.
+PreparedQueue prepareQueue(int startHead, const std::vector<int> &requests)
+{
+    PreparedQueue prepared;
+    prepared.startHead = startHead;
+    prepared.sorted = requests;
+    sortCylinders(prepared.sorted);
+    prepared.split = std::lower_bound(prepared.sorted.begin(), prepared.sorted.end(), startHead) - prepared.sorted.begin();
+    return prepared;
+}
+
+CompressedQueue compressSorted(const std::vector<int> &sorted)
+{
+    CompressedQueue queue;
+    queue.requestCount = sorted.size();
+    for (size_t i = 0; i < sorted.size(); ++i)
+    {
+        if (i == 0 || sorted[i] != sorted[i - 1])
+        {
+            queue.cylinders.push_back(sorted[i]);
+            queue.counts.push_back(0);
+        }
+        queue.counts.back()++;
+    }
+    return queue;
+}
+
+bool isDenseQueue(const CompressedQueue &queue)
+{
+    return !queue.cylinders.empty() && queue.cylinders.size() * 4 <= queue.requestCount;
+}
@@ -0,0 +1,135 @@
+#include "../Headers/DiskScheduling.h"
+#include <vector>
+#include <random>
+
+std::vector<Request> makeRequests(const std::vector<int> &cylinders, double sizeKB, double interArrivalMs, double writeFraction)
+{
+    std::vector<Request> requests(cylinders.size());
+    for (size_t i = 0; i < cylinders.size(); ++i)
+    {
+        requests[i].id = static_cast<int>(i);
+        requests[i].arrivalMs = i * interArrivalMs;
+        requests[i].cylinder = cylinders[i];
+        requests[i].sizeKB = sizeKB;
+        // Request i is a write when the running write count steps up at i
+        requests[i].isWrite = std::floor((i + 1) * writeFraction) > std::floor(i * writeFraction);
+    }
+    return requests;
+}
+
+void assignSectors(std::vector<Request> &requests, const DiskGeometry &geometry, unsigned long long seed)
+{
+    if (!geometry.enabled())
+        return;
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<int> sectorDist(0, geometry.sectorsPerTrack - 1);
+    for (Request &request : requests)
+        request.sector = sectorDist(rng);
+}
+
+ResponseTimeTracker::ResponseTimeTracker(const std::vector<Request> &requests, const DiskPerformanceParams &diskParams, double startClockMs)
+    : requests(requests), params(diskParams), completionMs(requests.size(), std::numeric_limits<double>::quiet_NaN()), clockMs(startClockMs)
+{
+    byCylinder.resize(requests.size());
+    std::iota(byCylinder.begin(), byCylinder.end(), 0);
+    std::sort(byCylinder.begin(), byCylinder.end(), [&](int a, int b)
+              {
+                  if (requests[a].cylinder != requests[b].cylinder)
+                      return requests[a].cylinder < requests[b].cylinder;
+                  if (requests[a].arrivalMs != requests[b].arrivalMs)
+                      return requests[a].arrivalMs < requests[b].arrivalMs;
+                  return a < b; });
+    for (size_t i = 0; i < byCylinder.size(); ++i)
+    {
+        int cylinder = requests[byCylinder[i]].cylinder;
+        if (cylinderKeys.empty() || cylinderKeys.back() != cylinder)
+        {
+            if (!cylinderKeys.empty())
+                cylinderEnd.push_back(i);
+            cylinderKeys.push_back(cylinder);
+            nextPending.push_back(i);
+        }
+    }
+    if (!cylinderKeys.empty())
+        cylinderEnd.push_back(byCylinder.size());
+}
+
+void ResponseTimeTracker::push(int cylinder)
+{
+    if (!started)
+    {
+        started = true;
+        currentHead = cylinder;
+        return;
+    }
+    clockMs += params.seekTimeMs(std::abs(cylinder - currentHead));
+    currentHead = cylinder;
+
+    auto key = std::lower_bound(cylinderKeys.begin(), cylinderKeys.end(), cylinder);
+    if (key == cylinderKeys.end() || *key != cylinder)
+        return; // Pass-through stop
+    size_t slot = key - cylinderKeys.begin();
+    size_t &cursor = nextPending[slot];
+    while (cursor < cylinderEnd[slot] && !std::isnan(completionMs[byCylinder[cursor]]))
+        cursor++; // Skip requests already served out of order
+    if (cursor == cylinderEnd[slot])
+        return; // Everything at this cylinder is already done
+
+    // In arrival order by default. With a geometry, the drive takes whichever arrived request
+    // on this track comes under the head first.
+    size_t pick = cursor;
+    if (params.geometry.enabled())
+    {
+        double bestDelay = std::numeric_limits<double>::infinity();
+        for (size_t i = cursor; i < cylinderEnd[slot] && requests[byCylinder[i]].arrivalMs <= clockMs; ++i)
+        {
+            int candidate = byCylinder[i];
+            if (!std::isnan(completionMs[candidate]))
+                continue;
+            double delay = rotationalDelayMs(params, requests[candidate], clockMs);
+            if (delay < bestDelay)
+            {
+                bestDelay = delay;
+                pick = i;
+            }
+        }
+    }
+    if (pick == cursor)
+        cursor++;
+    int index = byCylinder[pick];
+    const Request &request = requests[index];
+
+    // The head may get here before the request does; it then idles until the arrival
+    clockMs = std::max(clockMs, request.arrivalMs);
+    clockMs += rotationalDelayMs(params, request, clockMs) + params.transferTimeMs(request.sizeKB);
+    completionMs[index] = clockMs;
+    serviced++;
+}
+
+double ResponseTimeTracker::meanResponseMs() const
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < requests.size(); ++i)
+    {
+        if (!std::isnan(completionMs[i]))
+            sum += completionMs[i] - requests[i].arrivalMs;
+    }
+    return serviced > 0 ? sum / serviced : 0.0;
+}
+
+double ResponseTimeTracker::maxResponseMs() const
+{
+    double worst = 0.0;
+    for (size_t i = 0; i < requests.size(); ++i)
+    {
+        if (!std::isnan(completionMs[i]))
+            worst = std::max(worst, completionMs[i] - requests[i].arrivalMs);
+    }
+    return worst;
+}
+
+void ResponseTimeTracker::applyTo(AlgorithmResult &result) const
+{
+    result.meanResponseMs = meanResponseMs();
+    result.maxResponseMs = maxResponseMs();
+}
@@ -0,0 +1,107 @@
+#include "../Headers/DiskScheduling.h"
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+SeekCurve::SeekCurve(std::vector<double> timesMs) : table(std::move(timesMs))
+{
+    if (table.empty())
+        table.push_back(0.0);
+    if (table.size() >= 2)
+        tailSlopeMs = table.back() - table[table.size() - 2];
+}
+
+std::shared_ptr<const SeekCurve> makeParametricSeekCurve(int maxDistance, double settleMs, double sqrtMs,
+                                                         double linearMsPerCylinder, int kneeCylinders)
+{
+    std::vector<double> times(static_cast<size_t>(std::max(1, maxDistance)) + 1);
+    double knee = std::max(1, kneeCylinders);
+    double atKnee = settleMs + sqrtMs * std::sqrt(knee);
+    times[0] = 0.0;
+    for (size_t d = 1; d < times.size(); ++d)
+        times[d] = (d <= knee) ? settleMs + sqrtMs * std::sqrt(static_cast<double>(d))
+                               : atKnee + (d - knee) * linearMsPerCylinder;
+    return std::make_shared<const SeekCurve>(std::move(times));
+}
+
+std::shared_ptr<const SeekCurve> loadSeekProfile(const std::string &path, int maxDistance, std::string &error)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        error = "cannot open seek profile '" + path + "'";
+        return nullptr;
+    }
+    std::vector<std::pair<double, double>> points; // (distance, ms)
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        lineNumber++;
+        size_t hash = line.find('#');
+        if (hash != std::string::npos)
+            line.erase(hash);
+        std::istringstream fields(line);
+        double distance, timeMs;
+        if (!(fields >> distance))
+            continue; // Blank or comment line
+        if (!(fields >> timeMs) || distance < 0 || timeMs < 0)
+        {
+            error = path + ":" + std::to_string(lineNumber) + ": expected 'distance time_ms'";
+            return nullptr;
+        }
+        points.emplace_back(distance, timeMs);
+    }
+    if (points.empty())
+    {
+        error = "seek profile '" + path + "' has no data points";
+        return nullptr;
+    }
+    std::sort(points.begin(), points.end());
+    if (points.front().first > 0)
+        points.insert(points.begin(), {0.0, 0.0});
+
+    // Piecewise-linear through the points; past the last one, keep the last segment's slope
+    std::vector<double> times(static_cast<size_t>(std::max(1, maxDistance)) + 1);
+    size_t segment = 0;
+    for (size_t d = 0; d < times.size(); ++d)
+    {
+        while (segment + 2 < points.size() && points[segment + 1].first < d)
+            segment++;
+        if (points.size() == 1)
+        {
+            times[d] = points[0].second;
+            continue;
+        }
+        const auto &a = points[segment];
+        const auto &b = points[segment + 1];
+        double span = b.first - a.first;
+        times[d] = (span > 0) ? a.second + (d - a.first) * (b.second - a.second) / span : b.second;
+    }
+    times[0] = 0.0;
+    return std::make_shared<const SeekCurve>(std::move(times));
+}
+
+std::shared_ptr<const SeekCurve> parseSeekCurveSpec(const std::string &spec, int maxDistance, std::string &error)
+{
+    std::vector<double> values;
+    std::stringstream ss(spec);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        char *end = nullptr;
+        double value = std::strtod(item.c_str(), &end);
+        if (end == item.c_str() || value < 0)
+        {
+            error = "invalid seek curve value '" + item + "'";
+            return nullptr;
+        }
+        values.push_back(value);
+    }
+    if (values.size() != 4)
+    {
+        error = "seek curve needs settle_ms,sqrt_ms,linear_ms_per_cyl,knee_cylinders";
+        return nullptr;
+    }
+    return makeParametricSeekCurve(maxDistance, values[0], values[1], values[2], static_cast<int>(values[3]));
+}
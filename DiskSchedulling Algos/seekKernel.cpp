@@ -0,0 +1,181 @@
+#include "../Headers/DiskScheduling.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SEEK_KERNEL_HAS_AVX2 1
+#include <immintrin.h>
+#endif
+
+// The first pass gives the exact integer totals and with them the mean of the non-zero
+// distances; the second sums (d - mean)^2 over the non-zero d. Summing squared deviations
+// instead of forming sum(d^2) / n - mean^2 avoids the cancellation that loses the variance
+// of long, low-variance sequences.
+//
+// Both kernels accumulate the second pass in the same order so their outputs match bit for
+// bit: step j (the move into sequence[j + 1]) goes into lane j % 8 while full blocks of 8
+// steps remain, the leftover steps go into a sequential tail sum, and the lanes are reduced
+// as ((l0+l4) + (l1+l5)) + ((l2+l6) + (l3+l7)) + tail. Neither path is built with FMA, so
+// dev*dev + lane is never contracted differently between them.
+static double reduceLanes(const double lanes[8], double tail)
+{
+    double a0 = lanes[0] + lanes[4], a1 = lanes[1] + lanes[5];
+    double a2 = lanes[2] + lanes[6], a3 = lanes[3] + lanes[7];
+    return ((a0 + a1) + (a2 + a3)) + tail;
+}
+
+static SeekStats seekStatsScalar(const int *sequence, size_t length)
+{
+    SeekStats stats;
+    if (length < 2)
+        return stats;
+    size_t steps = length - 1;
+    for (size_t j = 0; j < steps; ++j)
+    {
+        int d = std::abs(sequence[j + 1] - sequence[j]);
+        stats.totalMovement += d;
+        stats.maxSeek = std::max(stats.maxSeek, d);
+        stats.nonZeroSeeks += (d != 0);
+    }
+    if (stats.nonZeroSeeks == 0)
+        return stats;
+
+    double mean = static_cast<double>(stats.totalMovement) / stats.nonZeroSeeks;
+    size_t blocked = steps - steps % 8;
+    double lanes[8] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    double tail = 0.0;
+    for (size_t j = 0; j < steps; ++j)
+    {
+        int d = std::abs(sequence[j + 1] - sequence[j]);
+        double deviation = d - mean;
+        double square = (d != 0) ? deviation * deviation : 0.0;
+        if (j < blocked)
+            lanes[j % 8] += square;
+        else
+            tail += square;
+    }
+    stats.m2 = reduceLanes(lanes, tail);
+    return stats;
+}
+
+#ifdef SEEK_KERNEL_HAS_AVX2
+__attribute__((target("avx2"))) static SeekStats seekStatsAvx2(const int *sequence, size_t length)
+{
+    SeekStats stats;
+    if (length < 2)
+        return stats;
+    size_t steps = length - 1;
+    size_t blocked = steps - steps % 8;
+
+    __m256i total = _mm256_setzero_si256();   // 4 x int64
+    __m256i maxSeek = _mm256_setzero_si256(); // 8 x int32
+    const __m256i zero = _mm256_setzero_si256();
+    long long zeroSeeks = 0;
+
+    // Zero seeks are counted in 8 x int32 lanes (-1 per hit), flushed per chunk so they never wrap
+    const size_t chunkSteps = size_t(1) << 28;
+    for (size_t chunkBegin = 0; chunkBegin < blocked; chunkBegin += chunkSteps)
+    {
+        size_t chunkEnd = std::min(blocked, chunkBegin + chunkSteps);
+        __m256i zeroCount = _mm256_setzero_si256();
+        for (size_t j = chunkBegin; j < chunkEnd; j += 8)
+        {
+            __m256i prev = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(sequence + j));
+            __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(sequence + j + 1));
+            __m256i d = _mm256_abs_epi32(_mm256_sub_epi32(next, prev));
+            maxSeek = _mm256_max_epi32(maxSeek, d);
+            zeroCount = _mm256_add_epi32(zeroCount, _mm256_cmpeq_epi32(d, zero));
+
+            __m128i dLow = _mm256_castsi256_si128(d);
+            __m128i dHigh = _mm256_extracti128_si256(d, 1);
+            total = _mm256_add_epi64(total, _mm256_cvtepi32_epi64(dLow));
+            total = _mm256_add_epi64(total, _mm256_cvtepi32_epi64(dHigh));
+        }
+        alignas(32) int counts[8];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(counts), zeroCount);
+        for (int c : counts)
+            zeroSeeks -= c;
+    }
+
+    alignas(32) long long totals[4];
+    alignas(32) int maxima[8];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(totals), total);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(maxima), maxSeek);
+
+    stats.totalMovement = totals[0] + totals[1] + totals[2] + totals[3];
+    stats.nonZeroSeeks = static_cast<long long>(blocked) - zeroSeeks;
+    for (int m : maxima)
+        stats.maxSeek = std::max(stats.maxSeek, m);
+
+    for (size_t j = blocked; j < steps; ++j)
+    {
+        int d = std::abs(sequence[j + 1] - sequence[j]);
+        stats.totalMovement += d;
+        stats.maxSeek = std::max(stats.maxSeek, d);
+        stats.nonZeroSeeks += (d != 0);
+    }
+    if (stats.nonZeroSeeks == 0)
+        return stats;
+
+    // Second pass: squared deviations from the mean, zero seeks masked out
+    const __m256d mean = _mm256_set1_pd(static_cast<double>(stats.totalMovement) / stats.nonZeroSeeks);
+    const __m128i zero128 = _mm_setzero_si128();
+    __m256d squaresLow = _mm256_setzero_pd();  // Lanes 0..3
+    __m256d squaresHigh = _mm256_setzero_pd(); // Lanes 4..7
+    for (size_t j = 0; j < blocked; j += 8)
+    {
+        __m256i prev = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(sequence + j));
+        __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(sequence + j + 1));
+        __m256i d = _mm256_abs_epi32(_mm256_sub_epi32(next, prev));
+        __m128i dLow = _mm256_castsi256_si128(d);
+        __m128i dHigh = _mm256_extracti128_si256(d, 1);
+        __m256d isZeroLow = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm_cmpeq_epi32(dLow, zero128)));
+        __m256d isZeroHigh = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm_cmpeq_epi32(dHigh, zero128)));
+        __m256d devLow = _mm256_sub_pd(_mm256_cvtepi32_pd(dLow), mean);
+        __m256d devHigh = _mm256_sub_pd(_mm256_cvtepi32_pd(dHigh), mean);
+        squaresLow = _mm256_add_pd(squaresLow, _mm256_andnot_pd(isZeroLow, _mm256_mul_pd(devLow, devLow)));
+        squaresHigh = _mm256_add_pd(squaresHigh, _mm256_andnot_pd(isZeroHigh, _mm256_mul_pd(devHigh, devHigh)));
+    }
+    alignas(32) double lanes[8];
+    _mm256_store_pd(lanes, squaresLow);
+    _mm256_store_pd(lanes + 4, squaresHigh);
+
+    double meanScalar = static_cast<double>(stats.totalMovement) / stats.nonZeroSeeks;
+    double tail = 0.0;
+    for (size_t j = blocked; j < steps; ++j)
+    {
+        int d = std::abs(sequence[j + 1] - sequence[j]);
+        double deviation = d - meanScalar;
+        tail += (d != 0) ? deviation * deviation : 0.0;
+    }
+    stats.m2 = reduceLanes(lanes, tail);
+    return stats;
+}
+#endif
+
+bool seekKernelAvailable(SeekKernel kernel)
+{
+    switch (kernel)
+    {
+    case SeekKernel::AVX2:
+#ifdef SEEK_KERNEL_HAS_AVX2
+        return __builtin_cpu_supports("avx2");
+#else
+        return false;
+#endif
+    default:
+        return true;
+    }
+}
+
+SeekStats computeSeekStats(const int *sequence, size_t length, SeekKernel kernel)
+{
+    if (kernel == SeekKernel::Auto)
+    {
+        static const bool useAvx2 = seekKernelAvailable(SeekKernel::AVX2);
+        kernel = useAvx2 ? SeekKernel::AVX2 : SeekKernel::Scalar;
+    }
+#ifdef SEEK_KERNEL_HAS_AVX2
+    if (kernel == SeekKernel::AVX2)
+        return seekStatsAvx2(sequence, length);
+#endif
+    return seekStatsScalar(sequence, length);
+}
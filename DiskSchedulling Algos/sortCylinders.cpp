@@ -0,0 +1,84 @@
+#include "../Headers/DiskScheduling.h"
+#include <vector>
+#include <cstdint>
+
+// Counting sort over [minValue, maxValue]: one histogram pass, one write-out pass.
+static void countingSort(std::vector<int> &values, int minValue, int maxValue)
+{
+    std::vector<uint32_t> counts(static_cast<size_t>(maxValue) - minValue + 1, 0);
+    for (int v : values)
+        counts[v - minValue]++;
+    size_t out = 0;
+    for (size_t bucket = 0; bucket < counts.size(); ++bucket)
+    {
+        int value = static_cast<int>(bucket) + minValue;
+        for (uint32_t c = counts[bucket]; c > 0; --c)
+            values[out++] = value;
+    }
+}
+
+// LSD radix sort on (value - minValue) with 11-bit digits; only as many passes as the range needs.
+static void radixSort(std::vector<int> &values, int minValue, int maxValue)
+{
+    const int digitBits = 11;
+    const uint32_t digitMask = (1u << digitBits) - 1;
+    uint32_t range = static_cast<uint32_t>(static_cast<long long>(maxValue) - minValue);
+    std::vector<int> buffer(values.size());
+    std::vector<size_t> counts(1u << digitBits);
+
+    int *src = values.data();
+    int *dst = buffer.data();
+    for (int shift = 0; shift < 32 && (range >> shift) != 0; shift += digitBits)
+    {
+        std::fill(counts.begin(), counts.end(), 0);
+        for (size_t i = 0; i < values.size(); ++i)
+            counts[((static_cast<uint32_t>(src[i]) - static_cast<uint32_t>(minValue)) >> shift) & digitMask]++;
+        size_t offset = 0;
+        for (size_t &c : counts)
+        {
+            size_t bucketSize = c;
+            c = offset;
+            offset += bucketSize;
+        }
+        for (size_t i = 0; i < values.size(); ++i)
+            dst[counts[((static_cast<uint32_t>(src[i]) - static_cast<uint32_t>(minValue)) >> shift) & digitMask]++] = src[i];
+        std::swap(src, dst);
+    }
+    if (src != values.data())
+        std::copy(src, src + values.size(), values.data());
+}
+
+SortBackend chooseSortBackend(size_t count, long long range)
+{
+    if (count < 256)
+        return SortBackend::Comparison;
+    if (range <= static_cast<long long>(count) * 2) // Histogram no bigger than ~2x the input
+        return SortBackend::Counting;
+    if (count >= 4096)
+        return SortBackend::Radix;
+    return SortBackend::Comparison;
+}
+
+void sortCylinders(std::vector<int> &cylinders, SortBackend backend)
+{
+    if (cylinders.size() < 2)
+        return;
+    auto [minIt, maxIt] = std::minmax_element(cylinders.begin(), cylinders.end());
+    int minValue = *minIt, maxValue = *maxIt;
+    long long range = static_cast<long long>(maxValue) - minValue + 1;
+    if (backend == SortBackend::Auto)
+        backend = chooseSortBackend(cylinders.size(), range);
+
+    switch (backend)
+    {
+    case SortBackend::Counting:
+        countingSort(cylinders, minValue, maxValue);
+        break;
+    case SortBackend::Radix:
+        radixSort(cylinders, minValue, maxValue);
+        break;
+    default:
+        std::sort(cylinders.begin(), cylinders.end());
+        break;
+    }
+}
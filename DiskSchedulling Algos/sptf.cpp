@@ -0,0 +1,126 @@
+#include "../Headers/DiskScheduling.h"
+#include "../Headers/SchedulerSinks.h"
+#include "../Headers/CylinderIndex.h"
+#include <vector>
+#include <algorithm>
+
+// Pending requests live in a CylinderIndex, and per cylinder in a vector kept sorted by
+// sector (unknown sectors, -1, first). The vectors sit in one flat array indexed by
+// cylinder and keep their capacity once emptied, so steady state allocates nothing per
+// request. A decision walks occupied cylinders outward from the head in order of distance;
+// on each cylinder only the request whose sector comes round first can be best, found
+// with one lookup. Rotational delay is under one revolution, so the walk stops
+// as soon as the seek time alone exceeds the best total found. Ties go to the lower index.
+// The disk becomes free at startClockMs, which also fixes the platter's angle at that point.
+std::vector<int> sptfOrder(int startHead, const std::vector<Request> &requests, const DiskPerformanceParams &diskParams,
+                           double startClockMs)
+{
+    std::vector<int> served;
+    served.reserve(requests.size());
+    if (requests.empty())
+        return served;
+
+    int maxCylinder = startHead;
+    for (const Request &request : requests)
+        maxCylinder = std::max(maxCylinder, request.cylinder);
+
+    // Seek cost by distance: the curve's own table when it covers every distance here (replay
+    // calls this once per window), otherwise a linear table built for this call
+    const double *seekCostMs;
+    std::vector<double> linearCostMs;
+    if (diskParams.seekCurve && diskParams.seekCurve->size() > static_cast<size_t>(maxCylinder))
+        seekCostMs = diskParams.seekCurve->times().data();
+    else
+    {
+        linearCostMs.resize(static_cast<size_t>(maxCylinder) + 1);
+        for (size_t d = 0; d < linearCostMs.size(); ++d)
+            linearCostMs[d] = diskParams.seekTimeMs(d);
+        seekCostMs = linearCostMs.data();
+    }
+
+    const DiskGeometry &geometry = diskParams.geometry;
+    std::vector<int> order = arrivalOrder(requests);
+    CylinderIndex index(maxCylinder);
+    using SectorList = std::vector<std::pair<int, int>>; // (sector, request), sorted
+    std::vector<SectorList> bySector(static_cast<size_t>(maxCylinder) + 1);
+
+    // Position in `pending` of the request reached first when the head lands at time t
+    auto firstOnCylinder = [&](const SectorList &pending, double timeMs) -> size_t
+    {
+        if (!geometry.enabled() || pending.front().first < 0)
+            return 0; // Unknown sectors cost the average, take the oldest such
+        std::pair<int, int> key{static_cast<int>(std::ceil(geometry.sectorAt(timeMs))), -1};
+        size_t at = std::lower_bound(pending.begin(), pending.end(), key) - pending.begin();
+        return at < pending.size() ? at : 0; // Wrap past sector 0
+    };
+
+    int head = startHead;
+    double clockMs = startClockMs;
+    size_t nextArrival = 0;
+    while (served.size() < requests.size())
+    {
+        for (; nextArrival < order.size() && requests[order[nextArrival]].arrivalMs <= clockMs; ++nextArrival)
+        {
+            const Request &request = requests[order[nextArrival]];
+            index.insert(request.cylinder);
+            SectorList &pending = bySector[request.cylinder];
+            std::pair<int, int> entry{request.sector, order[nextArrival]};
+            pending.insert(std::upper_bound(pending.begin(), pending.end(), entry), entry);
+        }
+        if (index.empty())
+        {
+            clockMs = requests[order[nextArrival]].arrivalMs;
+            continue;
+        }
+
+        double bestCostMs = std::numeric_limits<double>::infinity();
+        int bestCylinder = -1;
+        size_t best = 0;
+        int below = index.prevAtOrBelow(head);
+        int above = (head < maxCylinder) ? index.nextAtOrAbove(head + 1) : -1;
+        while (below >= 0 || above >= 0)
+        {
+            bool takeBelow = above < 0 || (below >= 0 && head - below <= above - head);
+            int cylinder = takeBelow ? below : above;
+            double seekMs = seekCostMs[std::abs(cylinder - head)];
+            if (seekMs > bestCostMs)
+                break; // Everything farther costs more
+            const SectorList &pending = bySector[cylinder];
+            size_t candidate = firstOnCylinder(pending, clockMs + seekMs);
+            int candidateIndex = pending[candidate].second;
+            double costMs = seekMs + rotationalDelayMs(diskParams, requests[candidateIndex], clockMs + seekMs);
+            if (costMs < bestCostMs || (costMs == bestCostMs && candidateIndex < bySector[bestCylinder][best].second))
+            {
+                bestCostMs = costMs;
+                bestCylinder = cylinder;
+                best = candidate;
+            }
+            if (takeBelow)
+                below = (below > 0) ? index.prevAtOrBelow(below - 1) : -1;
+            else
+                above = (above < maxCylinder) ? index.nextAtOrAbove(above + 1) : -1;
+        }
+
+        SectorList &pending = bySector[bestCylinder];
+        int chosen = pending[best].second;
+        pending.erase(pending.begin() + best);
+        index.remove(bestCylinder);
+
+        // Same clock arithmetic as serveRequest() / ResponseTimeTracker
+        const Request &request = requests[chosen];
+        clockMs += diskParams.seekTimeMs(std::abs(request.cylinder - head));
+        clockMs += rotationalDelayMs(diskParams, request, clockMs) + diskParams.transferTimeMs(request.sizeKB);
+        head = request.cylinder;
+        served.push_back(chosen);
+    }
+    return served;
+}
+
+std::vector<int> sptf(int startHead, const std::vector<Request> &requests, const DiskPerformanceParams &diskParams)
+{
+    std::vector<int> sequence;
+    sequence.reserve(requests.size() + 1);
+    VectorSink sink{sequence};
+    sptfTo(startHead, requests, diskParams, sink);
+    return sequence;
+}
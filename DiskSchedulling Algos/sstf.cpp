@@ -1,5 +1,10 @@
+#include "../Headers/DiskScheduling.h"
+#include "../Headers/SchedulerSinks.h"
 #include <vector>
-std::vector<int> sstf(int startHead, const std::vector<int> &requests)
+
+// Reference SSTF: linear nearest-neighbour scan plus erase per request, O(n^2).
+// Kept so the fast engine below can be diffed and timed against it.
+std::vector<int> sstf_reference(int startHead, const std::vector<int> &requests)
 {
     std::vector<int> sequence;
     sequence.push_back(startHead);
@@ -32,4 +37,76 @@ std::vector<int> sstf(int startHead, const std::vector<int> &requests)
         }
     }
     return sequence;
-}
\ No newline at end of file
+}
+
+// Distinct cylinders of the queue with their multiplicity and first index.
+// Dense queues are bucketed in one pass; sparse ones sort (cylinder, index) pairs.
+CompressedQueue compressQueue(const std::vector<int> &requests)
+{
+    CompressedQueue table;
+    table.requestCount = requests.size();
+    if (requests.empty())
+        return table;
+
+    auto [minIt, maxIt] = std::minmax_element(requests.begin(), requests.end());
+    long long range = static_cast<long long>(*maxIt) - *minIt + 1;
+    if (chooseSortBackend(requests.size(), range) == SortBackend::Counting)
+    {
+        // Dense queue: per-cylinder count and first index in one pass, no sort at all
+        std::vector<int> countOf(range, 0), firstOf(range, 0);
+        for (size_t i = 0; i < requests.size(); ++i)
+        {
+            int bucket = requests[i] - *minIt;
+            if (countOf[bucket]++ == 0)
+                firstOf[bucket] = static_cast<int>(i);
+        }
+        for (long long bucket = 0; bucket < range; ++bucket)
+        {
+            if (countOf[bucket] > 0)
+            {
+                table.cylinders.push_back(static_cast<int>(bucket + *minIt));
+                table.counts.push_back(countOf[bucket]);
+                table.firstIndex.push_back(firstOf[bucket]);
+            }
+        }
+    }
+    else
+    {
+        // Sort (cylinder, original index) pairs, then collapse duplicates.
+        std::vector<std::pair<int, int>> order;
+        order.reserve(requests.size());
+        for (size_t i = 0; i < requests.size(); ++i)
+            order.emplace_back(requests[i], static_cast<int>(i));
+        std::sort(order.begin(), order.end());
+
+        for (const auto &entry : order)
+        {
+            if (table.cylinders.empty() || table.cylinders.back() != entry.first)
+            {
+                table.cylinders.push_back(entry.first);
+                table.counts.push_back(0);
+                table.firstIndex.push_back(entry.second); // Smallest index, pairs are sorted
+            }
+            table.counts.back()++;
+        }
+    }
+    return table;
+}
+
+std::vector<int> expandQueue(const CompressedQueue &queue)
+{
+    std::vector<int> requests;
+    requests.reserve(queue.requestCount);
+    for (size_t i = 0; i < queue.cylinders.size(); ++i)
+        requests.insert(requests.end(), queue.counts[i], queue.cylinders[i]);
+    return requests;
+}
+
+std::vector<int> sstf(int startHead, const std::vector<int> &requests)
+{
+    std::vector<int> sequence;
+    sequence.reserve(requests.size() + 1);
+    VectorSink sink{sequence};
+    sstfTo(startHead, buildSstfTable(requests), sink);
+    return sequence;
+}
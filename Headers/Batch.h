@@ -0,0 +1,96 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <iostream>
+#include "DiskScheduling.h"
+#include "QueueGeneration.h"
+
+// Non-interactive parameter sweep. Every combination of the lists below is one
+// configuration; each configuration runs the standard and deadline algorithms and produces one
+// CSV row per algorithm. Lists are given as "a,b,c" or as an inclusive range "start:end:step".
+struct BatchConfig
+{
+    std::vector<int> startHeads = {50};
+    std::vector<int> maxCylinders = {199};
+    std::vector<int> queueSizes = {100};
+    std::vector<QueuePattern> patterns = {QueuePattern::Uniform};
+    int numClusters = 5;
+
+    // Zipf, hot/cold and locality tunables; each model is built once per disk size and reused
+    // by every trial
+    WorkloadParams workload;
+
+    // Reads the queue from a binary trace or a text file (commas or whitespace, "-" = stdin)
+    // instead of generating one; sizes and patterns are then ignored
+    std::string queueFile;
+
+    // DiskPerformanceParams inputs, as prompted for in interactive mode
+    std::vector<double> seekTimesMs = {0.1};
+    std::vector<double> rpms = {7200.0};
+    std::vector<double> transferRatesMBps = {100.0};
+    std::vector<double> requestSizesKB = {4.0};
+
+    // MQ-DL / FSCAN / N-SCAN tunables, the share of requests that are writes, and the gap
+    // between arrivals (0 = the whole queue is there at t = 0)
+    FairSchedulingParams fairParams;
+    double writeFraction = 0.0;
+    double interArrivalMs = 0.0;
+
+    // > 0 turns on the rotational geometry: every request gets a random sector, and response
+    // times (and SPTF's choices) use exact rotational delays instead of the average
+    int sectorsPerTrack = 0;
+
+    // Non-linear seek time: "settle,sqrt,linear,knee" or a measured profile file. Either
+    // replaces the linear seek-ms model; the profile wins when both are given.
+    std::string seekCurveSpec;
+    std::string seekProfilePath;
+
+    // Monte-Carlo trials: each configuration is repeated on `trials` independently seeded
+    // queues and every metric is reported as mean, stddev and 95% CI. Trial streams are
+    // derived from the master seed alone, so results do not depend on the thread count.
+    int trials = 1;
+
+    // Adds seek / service-time p50, p99 and p999 columns. With trials > 1 these come from
+    // the trials' histograms merged together (pooled), not from averaging per-trial values.
+    bool percentiles = false;
+
+    // > 0 replaces the algorithm table with closed-form SCAN / C-SCAN / LOOK / C-LOOK metrics
+    // for start heads 0, step, 2 * step, ... up to the max cylinder; startHeads is ignored
+    int headSweepStep = 0;
+
+    uint64_t seed = 1;        // Master seed; every queue gets its own derived stream
+    size_t numThreads = 0;    // 0 = one per hardware thread
+    std::string outputPath;   // Empty = stdout
+};
+
+// Mean, sample standard deviation and 95% confidence half-width (Student t) of trial values
+struct TrialSummary
+{
+    double mean = 0.0;
+    double stdDev = 0.0;
+    double ci95 = 0.0;
+};
+
+TrialSummary summarizeTrials(const std::vector<double> &values);
+
+void printBatchUsage(std::ostream &out);
+
+// "a,b,c" or inclusive "start:end:step" lists, shared with the other command-line modes
+bool parseNumberList(const std::string &text, std::vector<int> &values, std::string &error);
+bool parseNumberList(const std::string &text, std::vector<double> &values, std::string &error);
+
+// Command-line flags and config files use the same keys ("--rpm 5400,7200" / "rpm = 5400,7200")
+bool applyBatchOption(const std::string &key, const std::string &value, BatchConfig &config, std::string &error);
+bool loadBatchConfigFile(const std::string &path, BatchConfig &config, std::string &error);
+bool parseBatchArgs(int argc, char *argv[], BatchConfig &config, std::string &error);
+
+// Runs the sweep on a thread pool and writes the CSV; returns a process exit code
+int runBatch(const BatchConfig &config);
+
+// Entry point for "main --batch ..."
+int batchMain(int argc, char *argv[]);
+
+#endif // BATCH_H
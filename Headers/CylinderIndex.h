@@ -0,0 +1,52 @@
+#ifndef CYLINDERINDEX_H
+#define CYLINDERINDEX_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <unordered_map>
+
+// Pending-request occupancy over cylinders 0..maxCylinder, for schedulers that keep asking
+// "nearest pending cylinder above / below x" while requests come and go.
+//
+// Level 0 has one bit per cylinder, and every level above has one bit per non-empty word
+// of the level below, up to a single root word. next/prev scan one word per level with
+// count-trailing/leading-zeros, so every operation is O(log64 C): 4 levels at 1M cylinders.
+// Duplicate requests on a cylinder are counted in one byte per cylinder; the rare counts
+// past 254 spill into a side map. At 1M cylinders the whole index is ~1.1 MB.
+class CylinderIndex
+{
+public:
+    explicit CylinderIndex(int maxCylinder);
+
+    // Cylinders must be in 0..maxCylinder
+    void insert(int cylinder);
+    // Removes one request; returns false if the cylinder had none
+    bool remove(int cylinder);
+
+    uint32_t count(int cylinder) const;
+    bool contains(int cylinder) const { return (levels[0][cylinder >> 6] >> (cylinder & 63)) & 1; }
+    bool empty() const { return totalCount == 0; }
+    size_t size() const { return totalCount; }
+    int maxCylinder() const { return lastCylinder; }
+
+    // Nearest occupied cylinder >= / <= `cylinder`, or -1 when there is none
+    int nextAtOrAbove(int cylinder) const;
+    int prevAtOrBelow(int cylinder) const;
+    int first() const { return nextAtOrAbove(0); }
+    int last() const { return prevAtOrBelow(lastCylinder); }
+
+    size_t memoryBytes() const;
+
+private:
+    void setBit(int cylinder);
+    void clearBit(int cylinder);
+
+    int lastCylinder;
+    size_t totalCount = 0;
+    std::vector<std::vector<uint64_t>> levels; // levels[0] = per cylinder, back() = root word
+    std::vector<uint8_t> counts;               // 255 = look in overflow
+    std::unordered_map<int, uint32_t> overflow;
+};
+
+#endif // CYLINDERINDEX_H
@@ -7,39 +7,433 @@
 #include <numeric>
 #include <algorithm>
 #include <limits>
+#include <cstdlib>
+#include <memory>
+
+// Rotational position model: the platter turns once every revolutionMs starting at sector 0
+// at t = 0, so the angular position at any time is known. Disabled when sectorsPerTrack is 0,
+// in which case every access pays DiskPerformanceParams::avgRotationalLatencyMs.
+struct DiskGeometry
+{
+    int sectorsPerTrack = 0;
+    double revolutionMs = 0.0;
+
+    bool enabled() const { return sectorsPerTrack > 0 && revolutionMs > 0.0; }
+
+    // Fractional sector under the head at time t, in [0, sectorsPerTrack)
+    double sectorAt(double timeMs) const
+    {
+        double turns = timeMs / revolutionMs;
+        return (turns - std::floor(turns)) * sectorsPerTrack;
+    }
+
+    // Wait from time t until the start of `sector` passes under the head
+    double rotationalDelayMs(double timeMs, int sector) const
+    {
+        double gap = sector - sectorAt(timeMs);
+        if (gap < 0.0)
+            gap += sectorsPerTrack;
+        return gap / sectorsPerTrack * revolutionMs;
+    }
+};
+
+DiskGeometry makeDiskGeometry(int sectorsPerTrack, double rpm);
+
+// Seek time as a function of distance, tabulated once so a lookup is a single load.
+// Distances past the end of the table continue along the slope of its last step.
+class SeekCurve
+{
+public:
+    explicit SeekCurve(std::vector<double> timesMs); // timesMs[d] for d = 0, 1, 2, ...
+
+    double timeMs(long long distance) const
+    {
+        if (distance < static_cast<long long>(table.size()))
+            return table[distance];
+        return table.back() + (distance - static_cast<long long>(table.size()) + 1) * tailSlopeMs;
+    }
+    size_t size() const { return table.size(); }
+    const std::vector<double> &times() const { return table; } // timesMs[d] for d < size()
+
+private:
+    std::vector<double> table;
+    double tailSlopeMs = 0.0;
+};
+
+// Parametric curve after Ruemmler & Wilkes: settleMs + sqrtMs * sqrt(d) for short seeks up to
+// kneeCylinders, then linear at linearMsPerCylinder, continuous at the knee. Zero distance
+// costs nothing. Tabulated for distances 0..maxDistance.
+std::shared_ptr<const SeekCurve> makeParametricSeekCurve(int maxDistance, double settleMs, double sqrtMs,
+                                                         double linearMsPerCylinder, int kneeCylinders);
+
+// Measured profile: one "distance time_ms" pair per line (# starts a comment), linearly
+// interpolated into a table for 0..maxDistance. Returns nullptr and sets error on failure.
+std::shared_ptr<const SeekCurve> loadSeekProfile(const std::string &path, int maxDistance, std::string &error);
+
+// "settle,sqrt,linear,knee" -> makeParametricSeekCurve
+std::shared_ptr<const SeekCurve> parseSeekCurveSpec(const std::string &spec, int maxDistance, std::string &error);
 
 struct DiskPerformanceParams
 {
     double avgSeekTimePerCylinderMs = 0.1; // Default example value (ms)
     double avgRotationalLatencyMs = 4.0;   // Default example value (ms)
     double transferTimePerRequestMs = 1.0; // Default example value (ms)
+    double transferRateKBpms = 0.0;        // When > 0, a request's transfer time is its sizeKB / rate
+    DiskGeometry geometry;                 // Optional; enables exact rotational delays for requests with a sector
+    std::shared_ptr<const SeekCurve> seekCurve; // Optional; replaces the linear per-cylinder seek time
+
+    // Time to seek over `distance` cylinders
+    double seekTimeMs(long long distance) const
+    {
+        return seekCurve ? seekCurve->timeMs(distance) : static_cast<double>(distance) * avgSeekTimePerCylinderMs;
+    }
+
+    // Transfer time of one request of the given size, falling back to the per-request constant
+    double transferTimeMs(double sizeKB) const
+    {
+        return (transferRateKBpms > 0.0 && sizeKB > 0.0) ? sizeKB / transferRateKBpms : transferTimePerRequestMs;
+    }
+};
+
+// One I/O request with its identity, so completion times survive reordering
+struct Request
+{
+    int id = 0;
+    double arrivalMs = 0.0; // Time the request entered the queue
+    int cylinder = 0;
+    double sizeKB = 0.0;    // 0 = use DiskPerformanceParams::transferTimePerRequestMs
+    bool isWrite = false;   // Only the deadline scheduler treats reads and writes differently
+    int sector = -1;        // Angular position on the track; -1 = unknown (average rotation)
 };
 
+// Requests for a list of cylinders: ids follow queue order, arrivals are interArrivalMs apart.
+// A writeFraction share of them, spread evenly through the queue, are writes.
+std::vector<Request> makeRequests(const std::vector<int> &cylinders, double sizeKB, double interArrivalMs = 0.0,
+                                  double writeFraction = 0.0);
+
+// Gives every request a uniformly random sector of the geometry, reproducibly from `seed`
+void assignSectors(std::vector<Request> &requests, const DiskGeometry &geometry, unsigned long long seed);
+
+// Rotational delay for a request reaching the track at time t: exact when the geometry is
+// enabled and the sector known, the average latency otherwise
+inline double rotationalDelayMs(const DiskPerformanceParams &params, const Request &request, double timeMs)
+{
+    if (params.geometry.enabled() && request.sector >= 0)
+        return params.geometry.rotationalDelayMs(timeMs, request.sector);
+    return params.avgRotationalLatencyMs;
+}
+
+// Derive rotational latency (half a revolution) and per-request transfer time from drive specs
+DiskPerformanceParams deriveDiskParams(double seekTimePerCylinderMs, double rpm, double transferRateMBps, double avgRequestSizeKB);
+
+// Log-bucketed histogram of non-negative integers in the style of HdrHistogram: values
+// below 64 get exact buckets, larger ones 32 sub-buckets per power of two (<= ~3% error).
+// The bucket array has a fixed size (15 KB) and is allocated on first record, so unused
+// histograms cost nothing. Histograms from separate runs merge by adding counts.
+class LatencyHistogram
+{
+public:
+    static const int subBucketBits = 5;
+    static const int numBuckets = 64 + (63 - subBucketBits) * 32;
+
+    void record(unsigned long long value, unsigned long long count = 1);
+    void merge(const LatencyHistogram &other);
+
+    unsigned long long totalCount() const { return total; }
+    unsigned long long maxValue() const { return maxRecorded; }
+    // Highest value equivalent to the bucket holding the given percentile (0..100)
+    unsigned long long valueAtPercentile(double percentile) const;
+
+private:
+    static int bucketIndex(unsigned long long value);
+    static unsigned long long bucketUpperBound(int index);
+
+    std::vector<unsigned long long> counts;
+    unsigned long long total = 0;
+    unsigned long long maxRecorded = 0;
+};
+
+struct PercentileSummary
+{
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double p999 = 0.0;
+    double max = 0.0;
+};
+
+// Percentiles of a histogram, each value multiplied by `scale` (e.g. 0.001 for us -> ms)
+PercentileSummary summarizeHistogram(const LatencyHistogram &histogram, double scale = 1.0);
+
 struct AlgorithmResult
 {
     std::string name;
-    int totalMovement = 0;
+    long long totalMovement = 0; // 64-bit: long queues overflow int
     double avgSeek = 0.0;
     int maxSeek = 0;
     double stdDevSeek = 0.0;
     double throughput = 0.0;
     double avgResponseTime = 0.0; // Average time per request (Seek+Latency+Transfer) in ms
+    double meanResponseMs = 0.0;  // Mean completion - arrival per request, queueing delay included
+    double maxResponseMs = 0.0;   // Worst completion - arrival
     std::vector<int> seekSequence;
+
+    // Tail latency, only filled when MetricsOptions::collectPercentiles is set
+    bool hasPercentiles = false;
+    PercentileSummary seekPercentiles;    // Seek distance per step (cylinders)
+    PercentileSummary servicePercentiles; // Seek + rotation + transfer per step (ms)
+    LatencyHistogram seekHistogram;       // Cylinders
+    LatencyHistogram serviceHistogram;    // Microseconds
 };
 
+// Sorting backends for cylinder numbers. Auto picks counting sort when the value range is
+// small compared with the number of requests, LSD radix for large sparse queues, and
+// std::sort otherwise.
+enum class SortBackend
+{
+    Auto,
+    Comparison,
+    Counting,
+    Radix
+};
+
+SortBackend chooseSortBackend(size_t count, long long range);
+void sortCylinders(std::vector<int> &cylinders, SortBackend backend = SortBackend::Auto);
+
+// Requests sorted once and split around startHead; reused by SCAN, C-SCAN, LOOK, C-LOOK and HDSA
+struct PreparedQueue
+{
+    int startHead = 0;
+    std::vector<int> sorted; // Requests in ascending order
+    size_t split = 0;        // Index of the first request >= startHead
+};
+
+PreparedQueue prepareQueue(int startHead, const std::vector<int> &requests);
+
+// Compressed queue: the distinct cylinders of a queue in ascending order with their counts
+// and the index of their first occurrence (SSTF breaks equal-distance ties on it). With
+// millions of requests on a few thousand cylinders this is far smaller than the queue, and
+// the xxxTo() schedulers that take it run in O(distinct cylinders).
+struct CompressedQueue
+{
+    std::vector<int> cylinders;
+    std::vector<int> counts;
+    std::vector<int> firstIndex;
+    size_t requestCount = 0; // Sum of counts
+};
+
+using SstfTable = CompressedQueue;
+
+CompressedQueue compressQueue(const std::vector<int> &requests);
+inline SstfTable buildSstfTable(const std::vector<int> &requests) { return compressQueue(requests); }
+
+// Compresses an already sorted queue in one linear pass. firstIndex is left empty: the
+// original order is gone, so the result serves the elevators and HDSA but not SSTF.
+CompressedQueue compressSorted(const std::vector<int> &sorted);
+
+// The requests in ascending order, duplicates included
+std::vector<int> expandQueue(const CompressedQueue &queue);
+
+// True when a queue averages at least four requests per distinct cylinder, i.e. when
+// scheduling the compressed form pays for building it
+bool isDenseQueue(const CompressedQueue &queue);
+
 int run_sstf_subset(int currentHead, std::vector<int> &queue_subset, std::vector<int> &overall_sequence);
 
 std::vector<int> fcfs(int startHead, const std::vector<int> &requests);
 std::vector<int> sstf(int startHead, const std::vector<int> &requests);
+std::vector<int> sstf_reference(int startHead, const std::vector<int> &requests); // O(n^2) reference
 std::vector<int> scan(int startHead, int maxCylinder, const std::vector<int> &requests);
 std::vector<int> cscan(int startHead, int maxCylinder, const std::vector<int> &requests);
 std::vector<int> look(int startHead, const std::vector<int> &requests);
 std::vector<int> clook(int startHead, const std::vector<int> &requests);
 std::vector<int> hdsa(int startHead, const std::vector<int> &requests);
+std::vector<int> hdsa_reference(int startHead, const std::vector<int> &requests); // O(n^2) reference
+
+// Same sequences as above, computed from a queue prepared once with prepareQueue()
+std::vector<int> scan(const PreparedQueue &prepared, int maxCylinder);
+std::vector<int> cscan(const PreparedQueue &prepared, int maxCylinder);
+std::vector<int> look(const PreparedQueue &prepared);
+std::vector<int> clook(const PreparedQueue &prepared);
+std::vector<int> hdsa(const PreparedQueue &prepared);
+
+// Tunables of the starvation-bounded schedulers, defaults as in Linux mq-deadline
+struct FairSchedulingParams
+{
+    int nStep = 16;                // N-step SCAN: requests per frozen sweep
+    double readExpireMs = 500.0;   // mq-deadline: read FIFO expiry
+    double writeExpireMs = 5000.0; // mq-deadline: write FIFO expiry
+    int fifoBatch = 16;            // mq-deadline: requests per sorted batch
+    int writesStarved = 2;         // mq-deadline: read batches before pending writes must go
+};
+
+// Arrival-aware schedulers: only requests that have arrived by the time the disk is free
+// are eligible, so they take Requests and the disk timing instead of bare cylinders
+std::vector<int> mq_deadline(int startHead, const std::vector<Request> &requests, const DiskPerformanceParams &diskParams,
+                             const FairSchedulingParams &fairParams = FairSchedulingParams());
+std::vector<int> fscan(int startHead, const std::vector<Request> &requests, const DiskPerformanceParams &diskParams);
+std::vector<int> nstep_scan(int startHead, const std::vector<Request> &requests, const DiskPerformanceParams &diskParams, int nStep);
+
+// SPTF (shortest positioning time first): among the requests that have arrived, serve the
+// one with the least seek + rotational delay. Returns request indices in service order.
+std::vector<int> sptfOrder(int startHead, const std::vector<Request> &requests, const DiskPerformanceParams &diskParams,
+                           double startClockMs = 0.0);
+std::vector<int> sptf(int startHead, const std::vector<Request> &requests, const DiskPerformanceParams &diskParams);
+
+struct MetricsOptions
+{
+    bool storeSequence = false;      // Copy the sequence into AlgorithmResult::seekSequence
+    bool collectPercentiles = false; // Fill the seek / service-time histograms and percentiles
+};
+
+// Single-pass metrics over a head sequence, fed one cylinder at a time (the first one is
+// the start head). Keeps only running totals and a Welford mean/variance of the non-zero
+// seek distances, so it never allocates.
+class MetricsAccumulator
+{
+public:
+    explicit MetricsAccumulator(const DiskPerformanceParams &diskParams, const MetricsOptions &options = MetricsOptions());
+
+    void push(int cylinder);
+    // Same as `count` calls to push(cylinder), in O(1): the repeats are zero-length seeks
+    void pushRun(int cylinder, long long count);
+    AlgorithmResult result(const std::string &name, int numRequests) const;
+
+private:
+    DiskPerformanceParams params;
+    bool started = false;
+    int currentHead = 0;
+    long long steps = 0;
+    long long totalMovement = 0;
+    int maxSeek = 0;
+    long long nonZeroSeeks = 0;
+    double meanSeek = 0.0; // Welford running mean of non-zero distances
+    double m2Seek = 0.0;   // Welford sum of squared deviations
+    double totalServiceTimeMs = 0.0;
+    bool collectPercentiles = false;
+    LatencyHistogram seekHistogram;
+    LatencyHistogram serviceHistogram; // Microseconds
+};
+
+// Seek-distance statistics of a whole sequence, computed by a vectorized kernel.
+// Integer fields are exact; m2 comes from a second pass over the deviations from the
+// mean (no sum-of-squares cancellation), summed in a fixed lane order shared by every
+// kernel, so all kernels return bit-identical results.
+struct SeekStats
+{
+    long long totalMovement = 0;
+    int maxSeek = 0;
+    long long nonZeroSeeks = 0;
+    double m2 = 0.0; // Sum of squared deviations of the non-zero distances from their mean
+};
+
+enum class SeekKernel
+{
+    Auto, // AVX2 when the CPU supports it, scalar otherwise
+    Scalar,
+    AVX2
+};
+
+bool seekKernelAvailable(SeekKernel kernel);
+SeekStats computeSeekStats(const int *sequence, size_t length, SeekKernel kernel = SeekKernel::Auto);
+
+// Metrics of a sequence known only by its totals: `steps` moves with the given seek
+// statistics, taking totalServiceTimeMs altogether
+AlgorithmResult metricsFromSeekStats(const std::string &name, int numRequests, long long steps, const SeekStats &stats,
+                                     double totalServiceTimeMs);
+
+// Closed-form metrics of SCAN, C-SCAN, LOOK and C-LOOK. Each of their sequences is a few
+// fixed moves (to the first request, to an end of the disk, the jump back) plus sweeps over
+// the distinct cylinders below and above the head, where every seek is the gap between
+// neighbouring cylinders and each duplicate is a zero-length seek. With prefix sums of the
+// gaps and their squares and prefix / suffix maxima, any start head costs O(1) once its
+// split point is known, and no sequence is ever built.
+enum class ElevatorAlgorithm
+{
+    Scan,
+    CScan,
+    Look,
+    CLook
+};
+
+const char *elevatorName(ElevatorAlgorithm algorithm); // "SCAN", "C-SCAN", "LOOK", "C-LOOK"
+
+struct ElevatorTotals
+{
+    long long steps = 0;
+    SeekStats seeks;
+    double totalSeekTimeMs = 0.0;
+};
+
+class ElevatorProfile
+{
+public:
+    ElevatorProfile(const CompressedQueue &queue, const DiskPerformanceParams &diskParams);
+
+    // One start head, O(log distinct cylinders)
+    ElevatorTotals totals(ElevatorAlgorithm algorithm, int startHead, int maxCylinder) const;
+    AlgorithmResult evaluate(ElevatorAlgorithm algorithm, int startHead, int maxCylinder) const;
+
+    // Start heads 0, step, 2 * step, ... up to maxCylinder in one pass, O(heads + distinct)
+    std::vector<ElevatorTotals> sweepHeads(ElevatorAlgorithm algorithm, int maxCylinder, int step = 1) const;
+
+    AlgorithmResult result(ElevatorAlgorithm algorithm, const ElevatorTotals &totals) const;
+
+private:
+    ElevatorTotals totalsAt(ElevatorAlgorithm algorithm, int startHead, size_t split, int maxCylinder) const;
+
+    std::vector<int> cylinders;       // Distinct, ascending
+    long long requestCount = 0;
+    DiskPerformanceParams params;
+    std::vector<long long> gapSum;     // gapSum[k]: sum of the first k gaps
+    std::vector<long long> gapSquares; // Same for squared gaps
+    std::vector<double> gapSeekMs;     // Same for seek times, only with a seek curve
+    std::vector<int> prefixMax;        // prefixMax[k]: largest of the first k gaps
+    std::vector<int> suffixMax;        // suffixMax[k]: largest of gaps k, k + 1, ...
+};
+
+// Follows a head sequence in time and assigns each stop to the oldest pending request at
+// that cylinder; a stop with nothing pending there (e.g. SCAN's turn at cylinder 0) is a
+// pass-through that costs only its seek. Servicing waits for the request to arrive, then
+// pays rotational latency plus the request's transfer time. With params.geometry enabled the
+// latency is the exact wait for the request's sector, and among arrived requests on the same
+// cylinder the one whose sector comes round first is taken. Works as a scheduler sink.
+// The request list is referenced, not copied, and must outlive the tracker. A non-zero
+// startClockMs continues from an earlier batch (the disk is busy until then).
+class ResponseTimeTracker
+{
+public:
+    ResponseTimeTracker(const std::vector<Request> &requests, const DiskPerformanceParams &diskParams, double startClockMs = 0.0);
+
+    void push(int cylinder);
+
+    // Completion time of every request, in the order of the `requests` passed in
+    // (NaN for requests the sequence never reached)
+    const std::vector<double> &completionTimesMs() const { return completionMs; }
+    size_t servicedCount() const { return serviced; }
+    double clock() const { return clockMs; } // Time the last stop finished
+    double meanResponseMs() const;
+    double maxResponseMs() const;
+    void applyTo(AlgorithmResult &result) const; // Fills meanResponseMs / maxResponseMs
+
+private:
+    const std::vector<Request> &requests;
+    DiskPerformanceParams params;
+    std::vector<int> byCylinder;       // Request indices sorted by (cylinder, arrival, index)
+    std::vector<int> cylinderKeys;     // Distinct cylinders, ascending
+    std::vector<size_t> nextPending;   // Per distinct cylinder: cursor into byCylinder
+    std::vector<size_t> cylinderEnd;   // Per distinct cylinder: end of its range in byCylinder
+    std::vector<double> completionMs;
+    bool started = false;
+    int currentHead = 0;
+    double clockMs = 0.0;
+    size_t serviced = 0;
+};
 
 AlgorithmResult calculateMetrics(const std::string &name,
                                  const std::vector<int> &sequence,
                                  int numRequests,
-                                 const DiskPerformanceParams &diskParams);
+                                 const DiskPerformanceParams &diskParams,
+                                 const MetricsOptions &options = MetricsOptions());
 
 #endif // DISK_SCHEDULING_H
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include <string>
 #include <random>
 #include "DiskScheduling.h"
+#include "Runner.h"
 // input Functions
 int getPositiveIntInput(const std::string &prompt, int min_val = 0, int max_val = std::numeric_limits<int>::max());
 
@@ -19,6 +20,9 @@ void printGenWelcome();
 void printQueueGen(const std::vector<int> &queue);
 void plotScatter(const std::vector<int> &queue, int max_cylinder);
 void displayConfiguration(int startHead, int maxCylinder, const DiskPerformanceParams &diskParams, const std::vector<int> &initialQueue);
-void displaySummaryTable(const std::vector<AlgorithmResult> &results, int numRequests);
-void displayNotes(int numRequests);
+// showPercentiles adds seek / service-time tail columns (needs MetricsOptions::collectPercentiles)
+void displaySummaryTable(const std::vector<AlgorithmResult> &results, int numRequests, bool showPercentiles = false);
+// fairParams must be the ones the suite ran with, so the MQ-DL / N-SCAN note quotes them
+void displayNotes(int numRequests, const FairSchedulingParams &fairParams = FairSchedulingParams());
+void displaySuiteTiming(const SuiteTiming &timing);
 #endif // INPUTOUTPUT_H
\ No newline at end of file
@@ -5,6 +5,20 @@
 #include <vector>
 #include <string>
 #include <random>
+#include <cstdint>
+#include <memory>
+
+// Generation patterns, numbered as in the interactive menu
+enum class QueuePattern
+{
+    Uniform = 1,
+    Sequential = 2,
+    Clustered = 3,
+    Mixed = 4,
+    Zipf = 5,    // Skewed popularity: the k-th most popular cylinder gets weight 1 / k^s
+    HotCold = 6, // A hot band of the disk takes most of the requests
+    Locality = 7 // Sequential runs of geometric length, each starting at a Zipf-popular cylinder
+};
 
 std::vector<int> parseQueue(const std::string &s);
 
@@ -16,4 +30,130 @@ std::vector<int> generateSequential(int max_cylinder, int num_requests, std::mt1
 
 std::vector<int> generateMixed(int max_cylinder, int num_requests, std::mt19937 &rng);
 
+// Dispatch to one of the generators above; num_clusters is only used by Clustered. Skewed
+// patterns (see WorkloadModel below) use default WorkloadParams.
+std::vector<int> generatePattern(QueuePattern pattern, int max_cylinder, int num_requests, int num_clusters, std::mt19937 &rng);
+
+// Lower-case pattern names ("uniform", "sequential", "clustered", "mixed", "zipf", "hotcold",
+// "locality") for batch mode
+const char *patternName(QueuePattern pattern);
+bool parsePatternName(const std::string &name, QueuePattern &pattern);
+
+// Independent, reproducible seed for stream `streamIndex` of a run seeded with masterSeed
+uint64_t deriveSeed(uint64_t masterSeed, uint64_t streamIndex);
+
+// xoshiro256** (Blackman & Vigna), seeded through SplitMix64. jump() advances the state by
+// 2^128 draws, so streams obtained by repeated jumps never overlap.
+class Xoshiro256
+{
+public:
+    using result_type = uint64_t;
+    static constexpr uint64_t min() { return 0; }
+    static constexpr uint64_t max() { return ~0ull; }
+
+    explicit Xoshiro256(uint64_t seed);
+
+    uint64_t operator()()
+    {
+        uint64_t result = rotl(s[1] * 5, 7) * 9;
+        uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+        return result;
+    }
+
+    void jump();
+
+    // Uniform in [0, 1) with 53 random bits
+    double uniform01() { return ((*this)() >> 11) * 0x1.0p-53; }
+
+    // Uniform in [0, range), unbiased (Lemire's multiply-and-reject); range must be > 0
+    uint32_t below(uint32_t range)
+    {
+        uint64_t m = ((*this)() >> 32) * range;
+        if (static_cast<uint32_t>(m) < range)
+        {
+            uint32_t threshold = (0u - range) % range;
+            while (static_cast<uint32_t>(m) < threshold)
+                m = ((*this)() >> 32) * range;
+        }
+        return static_cast<uint32_t>(m >> 32);
+    }
+
+private:
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+    uint64_t s[4];
+};
+
+// Vose alias table: O(n) to build, O(1) per sample
+class AliasTable
+{
+public:
+    AliasTable() = default;
+    explicit AliasTable(const std::vector<double> &weights);
+
+    size_t size() const { return alias.size(); }
+    uint32_t sample(Xoshiro256 &rng) const
+    {
+        uint32_t column = rng.below(static_cast<uint32_t>(alias.size()));
+        return rng.uniform01() < probability[column] ? column : alias[column];
+    }
+
+private:
+    std::vector<double> probability;
+    std::vector<uint32_t> alias;
+};
+
+// Tunables of the skewed patterns
+struct WorkloadParams
+{
+    double zipfExponent = 0.99;  // Zipf and Locality run starts; 0 = uniform
+    double hotFraction = 0.2;    // HotCold: share of the cylinders that are hot
+    double hotProbability = 0.8; // HotCold: share of the requests that go to them
+    double meanRunLength = 16.0; // Locality: mean requests per sequential run
+    long long driftInterval = 0; // Requests between moves of the hot set (0 = it never moves)
+    double driftFraction = 0.05; // Share of the disk the hot set moves by each time
+};
+
+// Everything about a skewed pattern that does not depend on the seed. Building the Zipf
+// table is O(cylinders); build the model once and share it (read-only) across trials.
+struct WorkloadModel
+{
+    QueuePattern pattern = QueuePattern::Zipf;
+    int maxCylinder = 0;
+    WorkloadParams params;
+    AliasTable table;      // Zipf / Locality: popularity ranks; HotCold: the hot and cold tiers
+    uint64_t stride = 1;   // Scatters ranks over the disk: rank r sits at (base + r * stride) mod cylinders
+    uint64_t base = 0;     // Where rank 0 lands: mid-disk, like the HotCold band
+    int hotCylinders = 1;  // HotCold: width of the hot band
+    uint64_t driftStep = 0; // Cylinders the hot set moves by at every drift
+};
+
+bool isSkewedPattern(QueuePattern pattern);
+std::shared_ptr<const WorkloadModel> buildWorkloadModel(QueuePattern pattern, int maxCylinder, const WorkloadParams &params);
+
+// Requests [first, first + count) of a queue drawn from the model into out[0, count).
+// Zipf and HotCold requests are independent, so any split into ranges gives the same queue
+// as long as each range has its own stream; Locality is a Markov chain and must be
+// generated in one range.
+void generateWorkload(const WorkloadModel &model, size_t first, size_t count, Xoshiro256 &rng, int *out);
+std::vector<int> generateWorkload(const WorkloadModel &model, size_t numRequests, uint64_t seed);
+
+class ThreadPool;
+
+// Same patterns as generatePattern(), for very large queues. The output is cut into
+// fixed-size chunks generated side by side on `pool`; chunk k draws from the seed's stream
+// jumped k times, and cluster centres come from a hash of the cluster number, so the queue
+// depends only on the seed, never on the thread count. Mixed picks uniform-or-cluster per
+// request (60/40 on average) instead of shuffling two fixed parts. Sequential is a random
+// walk and stays serial, as does Locality. Skewed patterns use `model` when given (it must
+// match the pattern and disk size) and a default-parameter model otherwise. With
+// pool == nullptr every chunk runs on the calling thread.
+std::vector<int> generatePatternParallel(QueuePattern pattern, int max_cylinder, size_t num_requests, int num_clusters,
+                                         uint64_t seed, ThreadPool *pool = nullptr, const WorkloadModel *model = nullptr);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,46 @@
+#ifndef QUEUEPARSER_H
+#define QUEUEPARSER_H
+
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstddef>
+#include <iostream>
+
+// Bulk queue parser for large captured traces. Integers may be separated by any mix of
+// commas, spaces, tabs and newlines. Tokens are converted in place with std::from_chars,
+// so there is no per-token allocation. Malformed tokens are skipped but reported with
+// their byte offset in the input.
+
+struct QueueParseIssue
+{
+    size_t offset = 0;  // Byte offset of the token in the whole input
+    std::string token;  // Truncated to 32 characters
+    const char *reason; // "not an integer" or "out of range"
+};
+
+struct QueueParseResult
+{
+    std::vector<int> values;
+    std::vector<QueueParseIssue> issues; // The first maxReportedIssues problems
+    size_t issueCount = 0;               // All problems, including unreported ones
+    size_t bytesRead = 0;
+
+    static const size_t maxReportedIssues = 100;
+};
+
+// Parses buffer[0..length) as complete input; `baseOffset` is added to reported offsets.
+// Appends to `result`.
+void parseQueueBuffer(const char *buffer, size_t length, size_t baseOffset, QueueParseResult &result);
+
+// Reads the stream in chunks of chunkBytes, carrying a token split across chunks over to the
+// next one. Returns false on a read error.
+bool parseQueueStream(std::FILE *stream, QueueParseResult &result, size_t chunkBytes = 1 << 20);
+
+// "-" reads stdin. Returns false and sets `error` if the file cannot be read.
+bool parseQueueFile(const std::string &path, QueueParseResult &result, std::string &error);
+
+// One warning line per reported issue plus a total, nothing when the parse was clean
+void reportQueueParseIssues(const QueueParseResult &result, std::ostream &out);
+
+#endif // QUEUEPARSER_H
@@ -0,0 +1,122 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <iostream>
+#include "DiskScheduling.h"
+
+// Replays captured block I/O traces through the batch schedulers. The trace is streamed
+// and cut into bounded windows; each window is scheduled by every algorithm starting from
+// where that algorithm's head and clock ended the previous window, so memory stays
+// proportional to the window, not the trace.
+
+enum class BlockTraceFormat
+{
+    Auto,   // Binary when the file starts with the blktrace magic, text otherwise
+    Text,   // blkparse default output: "8,0 3 1 0.000000000 697 Q W 223490 + 8 [proc]"
+    Binary  // blktrace records (struct blk_io_trace), e.g. from "blkparse -d", either byte order
+};
+
+struct BlockTraceEvent
+{
+    double timeMs = 0.0;
+    uint64_t lba = 0; // 512-byte sectors
+    uint32_t sectors = 0;
+    bool isWrite = false;
+};
+
+// Streams the events of one action ('Q' queued, 'I' inserted, 'D' issued, 'C' completed)
+// from a trace. Lines or records of other actions, notify records, discards and zero-length
+// I/O are skipped; text lines that do not parse are counted as malformed.
+class BlockTraceReader
+{
+public:
+    BlockTraceReader() = default;
+    ~BlockTraceReader();
+    BlockTraceReader(const BlockTraceReader &) = delete;
+    BlockTraceReader &operator=(const BlockTraceReader &) = delete;
+
+    bool open(const std::string &path, BlockTraceFormat format, char action, std::string &error);
+    bool next(BlockTraceEvent &event);
+    bool binary() const { return isBinary; }
+
+    uint64_t recordsRead = 0; // Lines or records, whatever their action
+    uint64_t malformed = 0;
+
+private:
+    bool fill(size_t bytes);
+    bool nextLine(const char *&line, size_t &length);
+    bool nextText(BlockTraceEvent &event);
+    bool nextBinary(BlockTraceEvent &event);
+
+    std::FILE *file = nullptr;
+    bool isBinary = false;
+    bool swapBytes = false;
+    char action = 'Q';
+    uint32_t actionCode = 1;
+    std::vector<char> buffer;
+    size_t begin = 0, end = 0;
+    bool eof = false;
+};
+
+// LBA -> (cylinder, sector) for a classic CHS layout: a cylinder holds heads x
+// sectorsPerTrack sectors. LBAs past maxCylinder are clamped to it.
+struct ReplayGeometry
+{
+    int sectorsPerTrack = 63;
+    int heads = 16;
+    int maxCylinder = 65535;
+};
+
+struct ReplayConfig
+{
+    std::string tracePath;
+    BlockTraceFormat format = BlockTraceFormat::Auto;
+    char action = 'Q';
+    ReplayGeometry geometry;
+    int startHead = 0;
+
+    size_t windowRequests = 4096; // Requests per scheduling window
+    double windowMs = 0.0;        // > 0 also closes a window once it spans this much trace time
+    long long limit = 0;          // Stop after this many requests (0 = whole trace)
+
+    double seekTimeMs = 0.1, rpm = 7200.0, transferRateMBps = 100.0;
+    bool rotational = true; // Exact rotational delays from each request's sector
+    std::string seekCurveSpec, seekProfilePath;
+    FairSchedulingParams fairParams;
+
+    std::vector<std::string> algorithms; // Empty = all
+    size_t numThreads = 0;
+    std::string outputPath; // CSV; empty = stdout
+};
+
+struct ReplayStats
+{
+    long long requests = 0;
+    long long windows = 0;
+    long long clamped = 0; // LBAs beyond the last cylinder
+    double traceSpanMs = 0.0;
+};
+
+// Totals of one algorithm over the whole trace
+struct ReplayResult
+{
+    AlgorithmResult metrics;
+    PercentileSummary responsePercentiles; // ms
+    long long unserved = 0;
+};
+
+bool parseBlockTraceFormat(const std::string &name, BlockTraceFormat &format);
+
+// Runs the replay; returns false and sets `error` if the trace cannot be read
+bool replayTrace(const ReplayConfig &config, std::vector<ReplayResult> &results, ReplayStats &stats, std::string &error);
+
+void printReplayUsage(std::ostream &out);
+
+// Entry point for "main --replay ..."
+int replayMain(int argc, char *argv[]);
+
+#endif // REPLAY_H
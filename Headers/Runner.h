@@ -0,0 +1,45 @@
+#ifndef RUNNER_H
+#define RUNNER_H
+
+#include <vector>
+#include <string>
+#include <functional>
+#include "DiskScheduling.h"
+#include "ThreadPool.h"
+
+// One independent algorithm evaluation; run() must only read shared inputs
+struct AlgorithmJob
+{
+    std::string name;
+    std::function<AlgorithmResult()> run;
+};
+
+struct SuiteTiming
+{
+    double wallMs = 0.0;   // Elapsed time for the whole suite
+    double cpuMs = 0.0;    // Sum of per-job thread CPU time
+    size_t numThreads = 0; // Workers in the pool that ran it
+};
+
+// The seven standard algorithms (FCFS, SSTF, SCAN, C-SCAN, LOOK, C-LOOK, HDSA) in display
+// order. The queue, prepared queue and requests are captured by reference and must outlive
+// the jobs. When `requests` (one per queue entry) is given, the results also carry
+// per-request response times, and the arrival-aware MQ-DL (mq-deadline), FSCAN, N-SCAN
+// (N-step SCAN, tuned by `fairParams`) and SPTF follow; `metricsOptions` turns on
+// percentile histograms. SSTF always schedules a compressed table; dense queues (see
+// isDenseQueue) also run the elevators and HDSA on a compressed copy of the queue.
+std::vector<AlgorithmJob> standardAlgorithmJobs(int startHead, int maxCylinder,
+                                                const std::vector<int> &queue,
+                                                const PreparedQueue &preparedQueue,
+                                                const DiskPerformanceParams &diskParams,
+                                                const std::vector<Request> *requests = nullptr,
+                                                const MetricsOptions &metricsOptions = MetricsOptions(),
+                                                const FairSchedulingParams &fairParams = FairSchedulingParams());
+
+// Runs every job on the pool and returns the results in the order of `jobs`
+std::vector<AlgorithmResult> runAlgorithmSuite(const std::vector<AlgorithmJob> &jobs, ThreadPool &pool, SuiteTiming *timing = nullptr);
+
+// CPU time consumed by the calling thread, in ms
+double threadCpuTimeMs();
+
+#endif // RUNNER_H
@@ -0,0 +1,612 @@
+#ifndef SCHEDULER_SINKS_H
+#define SCHEDULER_SINKS_H
+
+#include <vector>
+#include <deque>
+#include <set>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include "DiskScheduling.h"
+
+// Sink-based scheduler API. Each xxxTo() function emits the head sequence (start head
+// first, exactly as the vector-returning functions do) by calling sink.push(cylinder)
+// once per stop. Any type with a push(int) member works as a sink, including
+// MetricsAccumulator, so metrics can be computed without materializing the sequence.
+// Schedulers over a CompressedQueue emit each cylinder's duplicates as one run; sinks with
+// a pushRun(int, long long) member take it whole, others get one push() per stop.
+
+template <typename Sink, typename = void>
+struct TakesRuns : std::false_type
+{
+};
+
+template <typename Sink>
+struct TakesRuns<Sink, std::void_t<decltype(std::declval<Sink &>().pushRun(0, 1ll))>> : std::true_type
+{
+};
+
+// `count` stops at one cylinder
+template <typename Sink>
+inline void emitRun(Sink &sink, int cylinder, long long count)
+{
+    if constexpr (TakesRuns<Sink>::value)
+        sink.pushRun(cylinder, count);
+    else
+    {
+        for (; count > 0; --count)
+            sink.push(cylinder);
+    }
+}
+
+// Appends to a caller-owned vector
+struct VectorSink
+{
+    std::vector<int> &out;
+    void push(int cylinder) { out.push_back(cylinder); }
+};
+
+// Writes into a caller-supplied buffer; stops writing once full but keeps counting
+struct SpanSink
+{
+    int *data;
+    size_t capacity;
+    size_t size = 0;
+    void push(int cylinder)
+    {
+        if (size < capacity)
+            data[size] = cylinder;
+        size++;
+    }
+    bool overflowed() const { return size > capacity; }
+};
+
+// Adapts any output iterator
+template <typename OutputIt>
+struct IteratorSink
+{
+    OutputIt it;
+    void push(int cylinder) { *it++ = cylinder; }
+};
+
+template <typename OutputIt>
+IteratorSink<OutputIt> makeIteratorSink(OutputIt it)
+{
+    return IteratorSink<OutputIt>{it};
+}
+
+// Forwards every stop to two sinks, e.g. a MetricsAccumulator and a ResponseTimeTracker
+template <typename First, typename Second>
+struct TeeSink
+{
+    First &first;
+    Second &second;
+    void push(int cylinder)
+    {
+        first.push(cylinder);
+        second.push(cylinder);
+    }
+    void pushRun(int cylinder, long long count)
+    {
+        emitRun(first, cylinder, count);
+        emitRun(second, cylinder, count);
+    }
+};
+
+// Keeps the sequence as (cylinder, count) runs; expand() materializes it
+struct RunSequence
+{
+    std::vector<int> cylinders;
+    std::vector<long long> counts;
+
+    void push(int cylinder) { pushRun(cylinder, 1); }
+    void pushRun(int cylinder, long long count)
+    {
+        if (count <= 0)
+            return;
+        if (!cylinders.empty() && cylinders.back() == cylinder)
+            counts.back() += count;
+        else
+        {
+            cylinders.push_back(cylinder);
+            counts.push_back(count);
+        }
+    }
+    long long length() const { return std::accumulate(counts.begin(), counts.end(), 0ll); }
+    std::vector<int> expand() const
+    {
+        std::vector<int> sequence;
+        sequence.reserve(length());
+        for (size_t i = 0; i < cylinders.size(); ++i)
+            sequence.insert(sequence.end(), counts[i], cylinders[i]);
+        return sequence;
+    }
+
+    // Replays the runs into another sink, e.g. a MetricsAccumulator
+    template <typename Sink>
+    void feed(Sink &sink) const
+    {
+        for (size_t i = 0; i < cylinders.size(); ++i)
+            emitRun(sink, cylinders[i], counts[i]);
+    }
+};
+
+template <typename Iterator, typename Sink>
+inline void pushRange(Iterator first, Iterator last, Sink &sink)
+{
+    for (; first != last; ++first)
+        sink.push(*first);
+}
+
+// Entries [first, last) of a compressed queue as runs, ascending or descending
+template <typename Sink>
+inline void pushRuns(const CompressedQueue &queue, size_t first, size_t last, Sink &sink)
+{
+    for (size_t i = first; i < last; ++i)
+        emitRun(sink, queue.cylinders[i], queue.counts[i]);
+}
+
+template <typename Sink>
+inline void pushRunsReverse(const CompressedQueue &queue, size_t first, size_t last, Sink &sink)
+{
+    for (size_t i = last; i > first; --i)
+        emitRun(sink, queue.cylinders[i - 1], queue.counts[i - 1]);
+}
+
+// Index of the first distinct cylinder >= head
+inline size_t compressedSplit(const CompressedQueue &queue, int head)
+{
+    return std::lower_bound(queue.cylinders.begin(), queue.cylinders.end(), head) - queue.cylinders.begin();
+}
+
+// FCFS: requests in arrival order
+template <typename Sink>
+void fcfsTo(int startHead, const std::vector<int> &requests, Sink &sink)
+{
+    sink.push(startHead);
+    pushRange(requests.begin(), requests.end(), sink);
+}
+
+// SSTF over a distinct-cylinder table with two frontier pointers, O(n log n) overall.
+// The serviced cylinders always form a contiguous range of the sorted table, so the
+// nearest pending request is either just below or just above that range. Once the head
+// lands on a cylinder all its duplicates are at distance 0 and are serviced next.
+// Ties between the two frontiers go to the cylinder whose first occurrence in the
+// request list comes earlier, which is what sstf_reference() picks.
+template <typename Sink>
+void sstfTo(int startHead, const SstfTable &table, Sink &sink)
+{
+    const std::vector<int> &cylinders = table.cylinders;
+    sink.push(startHead);
+    long long lo = static_cast<long long>(std::lower_bound(cylinders.begin(), cylinders.end(), startHead) - cylinders.begin()) - 1;
+    size_t hi = lo + 1;
+    int currentHead = startHead;
+    while (lo >= 0 || hi < cylinders.size())
+    {
+        bool takeLower;
+        if (lo < 0)
+            takeLower = false;
+        else if (hi >= cylinders.size())
+            takeLower = true;
+        else
+        {
+            long long downDistance = static_cast<long long>(currentHead) - cylinders[lo];
+            long long upDistance = static_cast<long long>(cylinders[hi]) - currentHead;
+            takeLower = (downDistance < upDistance) ||
+                        (downDistance == upDistance && table.firstIndex[lo] < table.firstIndex[hi]);
+        }
+        size_t pick = takeLower ? static_cast<size_t>(lo--) : hi++;
+        currentHead = cylinders[pick];
+        emitRun(sink, currentHead, table.counts[pick]);
+    }
+}
+
+// SCAN: downwards first to cylinder 0, then upwards
+template <typename Sink>
+void scanTo(const PreparedQueue &prepared, int /*maxCylinder*/, Sink &sink)
+{
+    sink.push(prepared.startHead);
+    if (prepared.sorted.empty())
+        return;
+
+    // lower = [begin, split) walked in reverse, upper = [split, end)
+    auto lowerBegin = prepared.sorted.begin();
+    auto split = prepared.sorted.begin() + prepared.split;
+    int currentHead = prepared.startHead;
+
+    // --- Movement Logic: DOWNWARDS FIRST ---
+    if (split != lowerBegin)
+    {
+        pushRange(std::make_reverse_iterator(split), std::make_reverse_iterator(lowerBegin), sink);
+        currentHead = *lowerBegin;
+    }
+    if (currentHead != 0) // Only move to end if requests exist
+    {
+        sink.push(0);
+    }
+    pushRange(split, prepared.sorted.end(), sink);
+}
+
+// C-SCAN: upwards to maxCylinder, jump to 0, then upwards again
+template <typename Sink>
+void cscanTo(const PreparedQueue &prepared, int maxCylinder, Sink &sink)
+{
+    sink.push(prepared.startHead);
+    if (prepared.sorted.empty())
+        return;
+
+    auto split = prepared.sorted.begin() + prepared.split;
+    int currentHead = prepared.startHead;
+
+    pushRange(split, prepared.sorted.end(), sink);
+    if (split != prepared.sorted.end())
+        currentHead = prepared.sorted.back();
+    if (currentHead != maxCylinder)
+    {
+        sink.push(maxCylinder);
+    }
+    if (prepared.split > 0)
+    {
+        sink.push(0); // Add 0 to sequence for the jump landing
+        pushRange(prepared.sorted.begin(), split, sink);
+    }
+}
+
+// LOOK: upper half ascending, then lower half descending
+template <typename Sink>
+void lookTo(const PreparedQueue &prepared, Sink &sink)
+{
+    sink.push(prepared.startHead);
+    auto split = prepared.sorted.begin() + prepared.split;
+    pushRange(split, prepared.sorted.end(), sink);
+    // Lower half descending, walked in reverse instead of re-sorting
+    pushRange(std::make_reverse_iterator(split), prepared.sorted.rend(), sink);
+}
+
+// C-LOOK: upper half ascending, then lower half ascending
+template <typename Sink>
+void clookTo(const PreparedQueue &prepared, Sink &sink)
+{
+    sink.push(prepared.startHead);
+    auto split = prepared.sorted.begin() + prepared.split;
+    pushRange(split, prepared.sorted.end(), sink);
+    pushRange(prepared.sorted.begin(), split, sink);
+}
+
+// HDSA on sorted sides. Every request in P lies below the head and every request in Q
+// above it, so SSTF inside one side is a plain sweep: P is serviced in descending order
+// and Q in ascending order, whichever side goes first. Both sides are ranges of the
+// prepared queue; requests equal to startHead are dropped as in hdsa_reference().
+template <typename Sink>
+void hdsaTo(const PreparedQueue &prepared, Sink &sink)
+{
+    sink.push(prepared.startHead);
+    if (prepared.sorted.empty())
+        return;
+
+    auto pBegin = prepared.sorted.begin();
+    auto pEnd = pBegin + prepared.split;
+    auto qBegin = std::upper_bound(pEnd, prepared.sorted.end(), prepared.startHead);
+    auto qEnd = prepared.sorted.end();
+
+    // Distance to the far end of each side, read straight off the sorted ranges
+    int x = (pBegin == pEnd) ? std::numeric_limits<int>::max() : prepared.startHead - *pBegin;
+    int y = (qBegin == qEnd) ? std::numeric_limits<int>::max() : *(qEnd - 1) - prepared.startHead;
+
+    if (x > y)
+    {
+        pushRange(qBegin, qEnd, sink);
+        pushRange(std::make_reverse_iterator(pEnd), std::make_reverse_iterator(pBegin), sink);
+    }
+    else
+    {
+        pushRange(std::make_reverse_iterator(pEnd), std::make_reverse_iterator(pBegin), sink);
+        pushRange(qBegin, qEnd, sink);
+    }
+}
+
+// --- Elevators over a compressed queue ---
+// Same sequences as the PreparedQueue versions above, one run per distinct cylinder
+
+template <typename Sink>
+void scanTo(int startHead, const CompressedQueue &queue, int /*maxCylinder*/, Sink &sink)
+{
+    sink.push(startHead);
+    if (queue.cylinders.empty())
+        return;
+    size_t split = compressedSplit(queue, startHead);
+    int currentHead = startHead;
+    if (split > 0)
+    {
+        pushRunsReverse(queue, 0, split, sink);
+        currentHead = queue.cylinders.front();
+    }
+    if (currentHead != 0)
+        sink.push(0);
+    pushRuns(queue, split, queue.cylinders.size(), sink);
+}
+
+template <typename Sink>
+void cscanTo(int startHead, const CompressedQueue &queue, int maxCylinder, Sink &sink)
+{
+    sink.push(startHead);
+    if (queue.cylinders.empty())
+        return;
+    size_t split = compressedSplit(queue, startHead);
+    int currentHead = startHead;
+    pushRuns(queue, split, queue.cylinders.size(), sink);
+    if (split != queue.cylinders.size())
+        currentHead = queue.cylinders.back();
+    if (currentHead != maxCylinder)
+        sink.push(maxCylinder);
+    if (split > 0)
+    {
+        sink.push(0);
+        pushRuns(queue, 0, split, sink);
+    }
+}
+
+template <typename Sink>
+void lookTo(int startHead, const CompressedQueue &queue, Sink &sink)
+{
+    sink.push(startHead);
+    size_t split = compressedSplit(queue, startHead);
+    pushRuns(queue, split, queue.cylinders.size(), sink);
+    pushRunsReverse(queue, 0, split, sink);
+}
+
+template <typename Sink>
+void clookTo(int startHead, const CompressedQueue &queue, Sink &sink)
+{
+    sink.push(startHead);
+    size_t split = compressedSplit(queue, startHead);
+    pushRuns(queue, split, queue.cylinders.size(), sink);
+    pushRuns(queue, 0, split, sink);
+}
+
+template <typename Sink>
+void hdsaTo(int startHead, const CompressedQueue &queue, Sink &sink)
+{
+    sink.push(startHead);
+    if (queue.cylinders.empty())
+        return;
+    size_t pEnd = compressedSplit(queue, startHead);
+    size_t qBegin = pEnd + (pEnd < queue.cylinders.size() && queue.cylinders[pEnd] == startHead ? 1 : 0);
+    size_t qEnd = queue.cylinders.size();
+
+    int x = (pEnd == 0) ? std::numeric_limits<int>::max() : startHead - queue.cylinders.front();
+    int y = (qBegin == qEnd) ? std::numeric_limits<int>::max() : queue.cylinders.back() - startHead;
+    if (x > y)
+    {
+        pushRuns(queue, qBegin, qEnd, sink);
+        pushRunsReverse(queue, 0, pEnd, sink);
+    }
+    else
+    {
+        pushRunsReverse(queue, 0, pEnd, sink);
+        pushRuns(queue, qBegin, qEnd, sink);
+    }
+}
+
+// --- Arrival-aware schedulers ---
+// These keep their own service clock (seek + rotation + transfer per request, as in
+// ResponseTimeTracker) and only consider requests whose arrival time has passed; with
+// nothing eligible the head waits for the next arrival.
+
+// Request indices in arrival order (ties by index)
+inline std::vector<int> arrivalOrder(const std::vector<Request> &requests)
+{
+    std::vector<int> order(requests.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b)
+                     { return requests[a].arrivalMs < requests[b].arrivalMs; });
+    return order;
+}
+
+// Moves the head to a request and advances the clock by its service time
+template <typename Sink>
+void serveRequest(const Request &request, const DiskPerformanceParams &params, int &head, double &clockMs, Sink &sink)
+{
+    clockMs += params.seekTimeMs(std::abs(request.cylinder - head));
+    clockMs += rotationalDelayMs(params, request, clockMs) + params.transferTimeMs(request.sizeKB);
+    head = request.cylinder;
+    sink.push(head);
+}
+
+// Serves one frozen batch of request indices as an elevator sweep: first everything in the
+// current direction, then the rest on the way back. Sweeps reverse at the last request
+// (LOOK-style) rather than at the end of the disk. Starts downwards like scanTo().
+template <typename Sink>
+void sweepBatchTo(std::vector<int> &batch, const std::vector<Request> &requests, const DiskPerformanceParams &params,
+                  int &head, bool &movingUp, double &clockMs, Sink &sink)
+{
+    std::sort(batch.begin(), batch.end(), [&](int a, int b)
+              { return requests[a].cylinder != requests[b].cylinder ? requests[a].cylinder < requests[b].cylinder : a < b; });
+    int startHead = head;
+    auto byCylinder = [&](int index, int cylinder)
+    { return requests[index].cylinder < cylinder; };
+    if (movingUp)
+    {
+        auto split = std::lower_bound(batch.begin(), batch.end(), startHead, byCylinder); // First >= head
+        for (auto it = split; it != batch.end(); ++it)
+            serveRequest(requests[*it], params, head, clockMs, sink);
+        for (auto it = std::make_reverse_iterator(split); it != batch.rend(); ++it)
+        {
+            serveRequest(requests[*it], params, head, clockMs, sink);
+            movingUp = false;
+        }
+    }
+    else
+    {
+        auto split = std::lower_bound(batch.begin(), batch.end(), startHead + 1, byCylinder); // First > head
+        for (auto it = std::make_reverse_iterator(split); it != batch.rend(); ++it)
+            serveRequest(requests[*it], params, head, clockMs, sink);
+        for (auto it = split; it != batch.end(); ++it)
+        {
+            serveRequest(requests[*it], params, head, clockMs, sink);
+            movingUp = true;
+        }
+    }
+}
+
+// N-step SCAN: pending requests are cut, in arrival order, into groups of nStep; each group
+// is frozen and swept completely before the next, so a request waits at most for the
+// groups ahead of it. nStep = 1 is FCFS, a huge nStep approaches FSCAN. The disk becomes
+// free at startClockMs (later than 0 when a replay window follows an earlier one).
+template <typename Sink>
+void nstepScanTo(int startHead, const std::vector<Request> &requests, const DiskPerformanceParams &params, int nStep, Sink &sink,
+                 double startClockMs = 0.0)
+{
+    sink.push(startHead);
+    std::vector<int> order = arrivalOrder(requests);
+    size_t step = static_cast<size_t>(std::max(1, nStep));
+    int head = startHead;
+    bool movingUp = false;
+    double clockMs = startClockMs;
+    std::vector<int> batch;
+    for (size_t next = 0; next < order.size();)
+    {
+        clockMs = std::max(clockMs, requests[order[next]].arrivalMs); // Idle until something arrives
+        batch.clear();
+        while (next < order.size() && batch.size() < step && requests[order[next]].arrivalMs <= clockMs)
+            batch.push_back(order[next++]);
+        sweepBatchTo(batch, requests, params, head, movingUp, clockMs, sink);
+    }
+}
+
+// FSCAN: every request pending when a sweep starts is frozen into that sweep; arrivals
+// during the sweep wait for the next one, so a long run of nearby arrivals cannot hold
+// the head in place.
+template <typename Sink>
+void fscanTo(int startHead, const std::vector<Request> &requests, const DiskPerformanceParams &params, Sink &sink,
+             double startClockMs = 0.0)
+{
+    nstepScanTo(startHead, requests, params, std::numeric_limits<int>::max(), sink, startClockMs);
+}
+
+// mq-deadline, after the Linux I/O scheduler: reads and writes each have a sorted queue and
+// an arrival FIFO with an expiry time. Requests go out in batches of up to fifoBatch in
+// ascending cylinder order; a new batch starts at the oldest request when its deadline has
+// passed (or nothing lies ahead of the head), otherwise it carries on upwards. Reads are
+// preferred, but pending writes get a batch after writesStarved read batches. The disk
+// becomes free at startClockMs.
+template <typename Sink>
+void mqDeadlineTo(int startHead, const std::vector<Request> &requests, const DiskPerformanceParams &params,
+                  const FairSchedulingParams &fairParams, Sink &sink, double startClockMs = 0.0)
+{
+    sink.push(startHead);
+    std::vector<int> order = arrivalOrder(requests);
+    std::set<std::pair<int, int>> sorted[2]; // (cylinder, index); 0 = reads, 1 = writes
+    std::deque<int> fifo[2];
+    std::vector<char> served(requests.size(), 0);
+    double expireMs[2] = {fairParams.readExpireMs, fairParams.writeExpireMs};
+
+    int head = startHead;
+    double clockMs = startClockMs;
+    size_t nextArrival = 0;
+    size_t remaining = requests.size();
+    int direction = 0;
+    int batchLeft = 0;
+    int starved = 0;
+    while (remaining > 0)
+    {
+        for (; nextArrival < order.size() && requests[order[nextArrival]].arrivalMs <= clockMs; ++nextArrival)
+        {
+            int index = order[nextArrival];
+            int dir = requests[index].isWrite ? 1 : 0;
+            sorted[dir].insert({requests[index].cylinder, index});
+            fifo[dir].push_back(index);
+        }
+        if (sorted[0].empty() && sorted[1].empty())
+        {
+            clockMs = requests[order[nextArrival]].arrivalMs;
+            continue;
+        }
+
+        // Carry on with the current batch while it has something ahead of the head
+        auto chosen = sorted[direction].end();
+        if (batchLeft > 0)
+            chosen = sorted[direction].lower_bound({head, -1});
+        if (chosen == sorted[direction].end())
+        {
+            bool reads = !sorted[0].empty(), writes = !sorted[1].empty();
+            if (reads && !(writes && starved++ >= fairParams.writesStarved))
+                direction = 0;
+            else
+            {
+                direction = 1;
+                starved = 0;
+            }
+            while (served[fifo[direction].front()])
+                fifo[direction].pop_front();
+            const Request &oldest = requests[fifo[direction].front()];
+            chosen = sorted[direction].lower_bound({head, -1});
+            if (chosen == sorted[direction].end() || oldest.arrivalMs + expireMs[direction] <= clockMs)
+                chosen = sorted[direction].lower_bound({oldest.cylinder, -1});
+            batchLeft = std::max(1, fairParams.fifoBatch);
+        }
+
+        int index = chosen->second;
+        sorted[direction].erase(chosen);
+        served[index] = 1;
+        serveRequest(requests[index], params, head, clockMs, sink);
+        batchLeft--;
+        remaining--;
+    }
+}
+
+// SPTF; the ordering itself lives in sptfOrder()
+template <typename Sink>
+void sptfTo(int startHead, const std::vector<Request> &requests, const DiskPerformanceParams &params, Sink &sink,
+            double startClockMs = 0.0)
+{
+    sink.push(startHead);
+    for (int index : sptfOrder(startHead, requests, params, startClockMs))
+        sink.push(requests[index].cylinder);
+}
+
+// Runs one scheduler straight into a MetricsAccumulator:
+//   scheduleMetrics("SCAN", n, params, [&](auto &sink) { scanTo(prepared, maxCylinder, sink); });
+template <typename Schedule>
+AlgorithmResult scheduleMetrics(const std::string &name, int numRequests, const DiskPerformanceParams &diskParams, Schedule &&schedule,
+                                const MetricsOptions &options = MetricsOptions())
+{
+    MetricsAccumulator accumulator(diskParams, options);
+    if (!options.storeSequence)
+    {
+        schedule(accumulator);
+        return accumulator.result(name, numRequests);
+    }
+    std::vector<int> sequence;
+    VectorSink store{sequence};
+    TeeSink<MetricsAccumulator, VectorSink> tee{accumulator, store};
+    schedule(tee);
+    AlgorithmResult result = accumulator.result(name, numRequests);
+    result.seekSequence.swap(sequence);
+    return result;
+}
+
+// Same, and also follows the requests in time to fill meanResponseMs / maxResponseMs
+template <typename Schedule>
+AlgorithmResult scheduleTimedMetrics(const std::string &name, const std::vector<Request> &requests, const DiskPerformanceParams &diskParams, Schedule &&schedule,
+                                     const MetricsOptions &options = MetricsOptions())
+{
+    MetricsAccumulator accumulator(diskParams, options);
+    ResponseTimeTracker tracker(requests, diskParams);
+    TeeSink<MetricsAccumulator, ResponseTimeTracker> tee{accumulator, tracker};
+    std::vector<int> sequence;
+    if (options.storeSequence)
+    {
+        VectorSink store{sequence};
+        TeeSink<decltype(tee), VectorSink> stored{tee, store};
+        schedule(stored);
+    }
+    else
+        schedule(tee);
+    AlgorithmResult result = accumulator.result(name, static_cast<int>(requests.size()));
+    tracker.applyTo(result);
+    result.seekSequence.swap(sequence);
+    return result;
+}
+
+#endif // SCHEDULER_SINKS_H
@@ -0,0 +1,144 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <deque>
+#include <cstdint>
+#include <iostream>
+#include "DiskScheduling.h"
+#include "ThreadPool.h"
+
+// Discrete-event simulation of one disk with requests arriving while the head moves.
+// Unlike the batch schedulers, an online policy only sees the requests that have arrived
+// so far and is asked for its next move every time the disk becomes free.
+
+enum class ArrivalProcess
+{
+    Poisson, // Exponential inter-arrival times at the configured rate
+    Bursty   // On/off modulated Poisson: bursts at burstFactor x the rate, silence in between
+};
+
+const char *arrivalProcessName(ArrivalProcess process);
+bool parseArrivalProcessName(const std::string &name, ArrivalProcess &process);
+
+struct PendingRequest
+{
+    long long id = 0;
+    int cylinder = 0;
+    double arrivalMs = 0.0;
+    double sizeKB = 0.0;
+};
+
+// What the disk does next: serve a request, move without serving (SCAN / C-SCAN going to
+// the end of the disk), or sit idle until the next arrival
+struct SchedulerDecision
+{
+    enum Kind
+    {
+        Idle,
+        Service,
+        Move
+    };
+    Kind kind = Idle;
+    PendingRequest request; // Service: removed from the policy's pending set
+    int cylinder = 0;       // Move: target cylinder
+};
+
+class OnlinePolicy
+{
+public:
+    virtual ~OnlinePolicy() = default;
+    virtual const char *name() const = 0;
+    virtual void add(const PendingRequest &request) = 0;
+    virtual size_t pending() const = 0;
+    // Called whenever the disk is free, with the head at `head`
+    virtual SchedulerDecision next(int head) = 0;
+};
+
+// "FCFS", "SSTF", "SCAN", "C-SCAN", "LOOK", "C-LOOK" or "HDSA" (case-insensitive);
+// returns nullptr for an unknown name
+std::unique_ptr<OnlinePolicy> makeOnlinePolicy(const std::string &name, int maxCylinder);
+const std::vector<std::string> &onlinePolicyNames();
+
+// Binary min-heap of timestamped events. Ties are broken by insertion order, so a run is
+// deterministic for a given seed.
+class EventQueue
+{
+public:
+    enum Kind : uint32_t
+    {
+        Arrival,
+        Completion
+    };
+    struct Event
+    {
+        double timeMs;
+        uint64_t sequence;
+        Kind kind;
+    };
+
+    void push(double timeMs, Kind kind);
+    Event pop();
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+
+private:
+    std::vector<Event> heap;
+    uint64_t nextSequence = 0;
+};
+
+struct SimulationConfig
+{
+    int maxCylinder = 199;
+    int startHead = 50;
+    DiskPerformanceParams diskParams;
+    double requestSizeKB = 4.0;
+
+    ArrivalProcess arrivals = ArrivalProcess::Poisson;
+    double arrivalRatePerSec = 100.0; // Long-run mean rate for both processes
+    double burstFactor = 4.0;         // Bursty: rate inside a burst relative to the mean
+    double burstMeanMs = 50.0;        // Bursty: mean burst length
+
+    long long numRequests = 100000;
+    long long warmupRequests = 0; // Completions left out of the response-time statistics
+    uint64_t seed = 1;            // Same seed = same arrival stream for every policy
+};
+
+struct SimulationResult
+{
+    std::string policy;
+    double offeredRatePerSec = 0.0;
+    long long completed = 0;
+    double simulatedMs = 0.0;      // Time of the last completion
+    double throughputPerSec = 0.0; // Completed requests over simulated time
+    double utilization = 0.0;      // Fraction of time the head was moving or transferring
+    long long totalMovement = 0;
+    double meanResponseMs = 0.0;
+    double maxResponseMs = 0.0;
+    PercentileSummary responsePercentiles; // ms
+    LatencyHistogram responseHistogram;    // Microseconds
+    size_t maxQueueLength = 0;
+    double meanQueueLength = 0.0; // Time-averaged pending requests
+    long long events = 0;
+    bool saturated = false; // Throughput fell below 95% of the offered rate
+};
+
+SimulationResult simulate(const SimulationConfig &config, OnlinePolicy &policy);
+
+// Every policy at every rate, run side by side on the pool; results are policy-major
+std::vector<SimulationResult> sweepArrivalRates(const SimulationConfig &config,
+                                                const std::vector<std::string> &policies,
+                                                const std::vector<double> &ratesPerSec,
+                                                ThreadPool &pool);
+
+// Highest swept rate the policy kept up with (0 when it saturated at every rate)
+double saturationRate(const std::vector<SimulationResult> &results, const std::string &policy);
+
+void printSimulationUsage(std::ostream &out);
+
+// Entry point for "main --simulate ..."
+int simulateMain(int argc, char *argv[]);
+
+#endif // SIMULATION_H
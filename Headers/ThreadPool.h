@@ -0,0 +1,52 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+// Fixed-size work-stealing pool. Every worker owns a deque: tasks submitted from a worker
+// go onto its own deque and are popped LIFO, tasks submitted from outside are dealt
+// round-robin, and an idle worker steals FIFO from the others. wait() blocks until every
+// submitted task has finished. A size of 0 means one worker per hardware thread.
+class ThreadPool
+{
+public:
+    explicit ThreadPool(size_t numThreads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    void submit(std::function<void()> task);
+    void wait();
+    size_t size() const { return workers.size(); }
+
+private:
+    struct WorkQueue
+    {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void workerLoop(size_t index);
+    bool takeTask(size_t index, std::function<void()> &task);
+
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    std::atomic<size_t> nextQueue{0};
+
+    std::mutex stateMutex; // Guards the counters, stopping and the sleep/wake protocol
+    std::condition_variable taskAvailable;
+    std::condition_variable allDone;
+    size_t queued = 0;  // Tasks submitted but not yet taken from a deque
+    size_t pending = 0; // Queued plus running tasks
+    bool stopping = false;
+};
+
+#endif // THREADPOOL_H
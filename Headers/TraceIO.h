@@ -0,0 +1,122 @@
+#ifndef TRACEIO_H
+#define TRACEIO_H
+
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <iostream>
+#include "DiskScheduling.h"
+
+// Binary trace files for queues and seek sequences, so that multi-million-entry queues can
+// be kept on disk and reloaded without regenerating or re-parsing text. A fixed 32-byte
+// little-endian header is followed by the cylinders, each stored as the zigzag-encoded
+// difference from the previous one (the first from startHead) in a LEB128 varint. Sorted or
+// local traces take about one byte per request.
+//
+//   offset  size  field
+//        0     4  magic "DTRC"
+//        4     2  version (1)
+//        6     1  kind (0 = queue, 1 = seek sequence)
+//        7     1  element width: bytes a raw cylinder needs (1, 2 or 4)
+//        8     4  maxCylinder
+//       12     4  startHead
+//       16     8  count
+//       24     8  payload bytes
+
+enum class TraceKind : uint8_t
+{
+    Queue = 0,
+    SeekSequence = 1
+};
+
+struct TraceHeader
+{
+    TraceKind kind = TraceKind::Queue;
+    int elementWidth = 4;
+    int maxCylinder = 0;
+    int startHead = 0;
+    uint64_t count = 0;
+    uint64_t payloadBytes = 0;
+};
+
+// Streaming writer; it is a sink (push(int)), so the scheduler *To templates can write a
+// seek sequence straight to disk. The header is completed by close().
+class TraceWriter
+{
+public:
+    TraceWriter() = default;
+    ~TraceWriter();
+    TraceWriter(const TraceWriter &) = delete;
+    TraceWriter &operator=(const TraceWriter &) = delete;
+
+    bool open(const std::string &path, TraceKind kind, int maxCylinder, int startHead, std::string &error);
+    void push(int cylinder);
+    bool close(std::string &error);
+
+private:
+    void flush();
+
+    std::FILE *file = nullptr;
+    std::vector<uint8_t> buffer;
+    TraceHeader header;
+    int previous = 0;
+    bool writeFailed = false;
+};
+
+// Memory-maps the file (plain read on Windows) and decodes on demand, so the encoded form
+// is never copied and a queue can be consumed in blocks without holding all of it.
+class TraceReader
+{
+public:
+    TraceReader() = default;
+    ~TraceReader();
+    TraceReader(const TraceReader &) = delete;
+    TraceReader &operator=(const TraceReader &) = delete;
+
+    bool open(const std::string &path, std::string &error);
+    const TraceHeader &header() const { return fileHeader; }
+    uint64_t remaining() const { return fileHeader.count - decoded; }
+
+    // Decodes up to maxValues into `out` and returns how many were decoded; 0 at the end or
+    // on a corrupt payload (then failed() is set)
+    size_t read(int *out, size_t maxValues);
+    bool failed() const { return !errorMessage.empty(); }
+    const std::string &error() const { return errorMessage; }
+
+    // Decodes everything that is left into `values`
+    bool readAll(std::vector<int> &values, std::string &error);
+
+private:
+    void release();
+
+    TraceHeader fileHeader;
+    const uint8_t *mapped = nullptr;
+    size_t mappedBytes = 0;
+    std::vector<uint8_t> fallback; // _WIN32: the file read into memory
+    const uint8_t *cursor = nullptr;
+    const uint8_t *end = nullptr;
+    int previous = 0;
+    uint64_t decoded = 0;
+    std::string errorMessage;
+};
+
+bool writeQueueTrace(const std::string &path, const std::vector<int> &queue, int maxCylinder, int startHead, std::string &error);
+
+// The sequence must have been stored (MetricsOptions::storeSequence); its first entry is the
+// start head
+bool writeSeekSequenceTrace(const std::string &path, const AlgorithmResult &result, int maxCylinder, std::string &error);
+
+// True when the file starts with the trace magic
+bool isTraceFile(const std::string &path);
+
+// Loads a queue from a binary trace or a text file (commas / whitespace, "-" = stdin).
+// Malformed text tokens are reported on `warnings` and skipped.
+bool loadQueueFile(const std::string &path, std::vector<int> &queue, std::string &error, std::ostream &warnings = std::cerr);
+
+void printTraceUsage(std::ostream &out);
+
+// Entry point for "main --trace ..."
+int traceMain(int argc, char *argv[]);
+
+#endif // TRACEIO_H
@@ -1,5 +1,6 @@
 #include "../Headers/InputOutput.h"
 #include "../Headers/DiskScheduling.h"
+#include "../Headers/QueueParser.h"
 #include <iostream>
 #include <vector>
 #include <string>
@@ -77,28 +78,11 @@ double getPositiveDoubleInput(const std::string &prompt, double min_val, double
 
 std::vector<int> parseQueue(const std::string &s)
 {
-    std::vector<int> queue;
-    std::stringstream ss(s);
-    std::string segment;
-    while (std::getline(ss, segment, ','))
-    {
-        try
-        {
-            segment.erase(0, segment.find_first_not_of(" \t\n\r\f\v"));
-            segment.erase(segment.find_last_not_of(" \t\n\r\f\v") + 1);
-            if (!segment.empty())
-            {
-                queue.push_back(std::stoi(segment));
-            }
-        }
-        catch (const std::invalid_argument &e)
-        { /* Quiet warning */
-        }
-        catch (const std::out_of_range &e)
-        { /* Quiet warning */
-        }
-    }
-    return queue;
+    // Commas and any whitespace separate values; bad tokens are skipped with a warning
+    QueueParseResult result;
+    parseQueueBuffer(s.data(), s.size(), 0, result);
+    reportQueueParseIssues(result, std::cerr);
+    return result.values;
 }
 
 int getGenUserChoice()
@@ -106,16 +90,16 @@ int getGenUserChoice()
     int choice;
     while (true)
     {
-        std::cout << "Generation Choice (1-4): ";
+        std::cout << "Generation Choice (1-7): ";
         std::cin >> choice;
-        if (std::cin.good() && choice >= 1 && choice <= 4)
+        if (std::cin.good() && choice >= 1 && choice <= 7)
         {
             std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
             return choice;
         }
         else
         {
-            std::cout << "Invalid input. Please enter 1, 2, 3, or 4."
+            std::cout << "Invalid input. Please enter a number from 1 to 7."
                       << std::endl;
             std::cin.clear();
             std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
@@ -131,6 +115,9 @@ void printGenWelcome()
     std::cout << "  2) Sequential" << std::endl;
     std::cout << "  3) Clustered (with density)" << std::endl;
     std::cout << "  4) Mixed (Random + Clustered)" << std::endl;
+    std::cout << "  5) Zipf (skewed popularity)" << std::endl;
+    std::cout << "  6) Hot/Cold (hot band of the disk)" << std::endl;
+    std::cout << "  7) Locality (sequential runs from popular cylinders)" << std::endl;
 }
 
 void printQueueGen(const std::vector<int> &queue)
@@ -191,7 +178,11 @@ void displayConfiguration(int startHead, int maxCylinder, const DiskPerformanceP
     std::cout << "Start Head:    " << startHead << std::endl;
     std::cout << "Max Cylinder:  " << maxCylinder << std::endl;
     std::cout << std::fixed << std::setprecision(2);
-    std::cout << "Seek Time/Cyl: " << diskParams.avgSeekTimePerCylinderMs << " ms" << std::endl;
+    if (diskParams.seekCurve)
+        std::cout << "Seek Curve:    " << diskParams.seekTimeMs(1) << " ms (1 cyl) to " << diskParams.seekTimeMs(maxCylinder)
+                  << " ms (full stroke)" << std::endl;
+    else
+        std::cout << "Seek Time/Cyl: " << diskParams.avgSeekTimePerCylinderMs << " ms" << std::endl;
     std::cout << "Avg Rot Latency:" << diskParams.avgRotationalLatencyMs << " ms" << std::endl;
     std::cout << "Avg Xfer Time: " << diskParams.transferTimePerRequestMs << " ms" << std::endl;
     std::cout << std::defaultfloat;
@@ -206,9 +197,9 @@ void displayConfiguration(int startHead, int maxCylinder, const DiskPerformanceP
     std::cout << std::endl;
 }
 
-void displaySummaryTable(const std::vector<AlgorithmResult> &results, int numRequests)
+void displaySummaryTable(const std::vector<AlgorithmResult> &results, int numRequests, bool showPercentiles)
 {
-    int minTotalMovement = std::numeric_limits<int>::max();
+    long long minTotalMovement = std::numeric_limits<long long>::max();
     bool movementOccurred = false;
     if (!results.empty())
     {
@@ -226,15 +217,33 @@ void displaySummaryTable(const std::vector<AlgorithmResult> &results, int numReq
     }
 
     std::cout << "\n--- Algorithm Comparison Summary ---" << std::endl;
-    std::cout << std::left << std::setw(11) << "Algorithm" << "| "
+    std::cout << std::left << std::setw(13) << "Algorithm" << "| "
               << std::right << std::setw(10) << "Total Move" << " | "
               << std::right << std::setw(10) << "Avg Seek" << " | "
               << std::right << std::setw(10) << "Max Seek" << " | "
               << std::right << std::setw(11) << "StdDev Seek" << " | "
               << std::right << std::setw(10) << "Throughput" << " |"
-              << std::right << std::setw(14) << "Avg Resp(ms)" // New column
-              << std::endl;
-    std::cout << "-----------|------------|------------|------------|-------------|------------|--------------" << std::endl; // Adjusted separator
+              << std::right << std::setw(14) << "Avg Resp(ms)" << " |"
+              << std::right << std::setw(13) << "Mean RT(ms)" << " |"
+              << std::right << std::setw(13) << "Max RT(ms)";
+    if (showPercentiles)
+    {
+        std::cout << " |" << std::right << std::setw(10) << "Seek p50"
+                  << " |" << std::right << std::setw(10) << "Seek p90"
+                  << " |" << std::right << std::setw(10) << "Seek p99"
+                  << " |" << std::right << std::setw(10) << "Seek p999"
+                  << " |" << std::right << std::setw(10) << "Seek max"
+                  << " |" << std::right << std::setw(13) << "Svc p50(ms)"
+                  << " |" << std::right << std::setw(13) << "Svc p90(ms)"
+                  << " |" << std::right << std::setw(13) << "Svc p99(ms)"
+                  << " |" << std::right << std::setw(14) << "Svc p999(ms)"
+                  << " |" << std::right << std::setw(13) << "Svc max(ms)";
+    }
+    std::cout << std::endl;
+    std::cout << "-------------|------------|------------|------------|-------------|------------|---------------|--------------|-------------"; // Adjusted separator
+    if (showPercentiles)
+        std::cout << "|-----------|-----------|-----------|-----------|-----------|--------------|--------------|--------------|---------------|--------------";
+    std::cout << std::endl;
 
     std::cout << std::fixed << std::setprecision(2);
     for (const auto &result : results)
@@ -243,7 +252,7 @@ void displaySummaryTable(const std::vector<AlgorithmResult> &results, int numReq
         std::string nameWithBest = result.name;
         if (isBest)
             nameWithBest += " [BEST]";
-        std::cout << std::left << std::setw(11) << nameWithBest << "| "
+        std::cout << std::left << std::setw(13) << nameWithBest << "| "
                   << std::right << std::setw(10) << result.totalMovement << " | "
                   << std::right << std::setw(10) << result.avgSeek << " | "
                   << std::right << std::setw(10) << result.maxSeek << " | "
@@ -260,13 +269,31 @@ void displaySummaryTable(const std::vector<AlgorithmResult> &results, int numReq
         std::cout << " |";
 
         std::cout << std::fixed << std::setprecision(2);
-        std::cout << std::right << std::setw(14) << result.avgResponseTime;
+        std::cout << std::right << std::setw(14) << result.avgResponseTime << " |";
+        std::cout << std::right << std::setw(13) << result.meanResponseMs << " |";
+        std::cout << std::right << std::setw(13) << result.maxResponseMs;
+        if (showPercentiles)
+        {
+            // Seek percentiles are whole cylinders (bucket upper bounds), service times in ms
+            std::cout << std::setprecision(0)
+                      << " |" << std::right << std::setw(10) << result.seekPercentiles.p50
+                      << " |" << std::right << std::setw(10) << result.seekPercentiles.p90
+                      << " |" << std::right << std::setw(10) << result.seekPercentiles.p99
+                      << " |" << std::right << std::setw(10) << result.seekPercentiles.p999
+                      << " |" << std::right << std::setw(10) << result.seekPercentiles.max
+                      << std::setprecision(2)
+                      << " |" << std::right << std::setw(13) << result.servicePercentiles.p50
+                      << " |" << std::right << std::setw(13) << result.servicePercentiles.p90
+                      << " |" << std::right << std::setw(13) << result.servicePercentiles.p99
+                      << " |" << std::right << std::setw(14) << result.servicePercentiles.p999
+                      << " |" << std::right << std::setw(13) << result.servicePercentiles.max;
+        }
 
         std::cout << std::endl;
     }
 }
 
-void displayNotes(int numRequests)
+void displayNotes(int numRequests, const FairSchedulingParams &fairParams)
 {
     std::cout << "\nNote: [BEST] indicates the algorithm with the lowest Total Head Movement."
               << std::endl;
@@ -275,4 +302,23 @@ void displayNotes(int numRequests)
     std::cout << "Note: Avg Resp(ms) = Avg(Seek Time + Rotational Latency + Transfer Time) per request service."
               << std::endl;
     std::cout << "Note: Queueing Delay (time before scheduling) is not included in Avg Response Time." << std::endl;
+    std::cout << "Note: Mean/Max RT(ms) = completion - arrival per request, so they include Queueing Delay (all requests arrive at t=0)."
+              << std::endl;
+    // Formatted apart from std::cout, which is still in the table's fixed two-decimal mode
+    std::ostringstream readExpiry;
+    readExpiry << fairParams.readExpireMs;
+    std::cout << "Note: MQ-DL = mq-deadline (" << readExpiry.str() << " ms read expiry), N-SCAN = N-step SCAN (N = "
+              << fairParams.nStep << "); both bound Max RT at some cost in movement." << std::endl;
+    std::cout << "Note: SPTF = shortest positioning time first (seek + rotation); without a sector geometry it orders by seek time only."
+              << std::endl;
+}
+
+void displaySuiteTiming(const SuiteTiming &timing)
+{
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\nTiming: " << timing.wallMs << " ms wall, " << timing.cpuMs << " ms summed CPU across "
+              << timing.numThreads << " threads";
+    if (timing.wallMs > 0.0)
+        std::cout << " (" << timing.cpuMs / timing.wallMs << "x parallelism)";
+    std::cout << std::defaultfloat << std::endl;
 }
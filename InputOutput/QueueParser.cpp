@@ -0,0 +1,111 @@
+#include "../Headers/QueueParser.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <cerrno>
+
+static inline bool isSeparator(char c)
+{
+    return c == ',' || c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\f' || c == '\v';
+}
+
+static void addIssue(QueueParseResult &result, size_t offset, const char *begin, const char *end, const char *reason)
+{
+    result.issueCount++;
+    if (result.issues.size() >= QueueParseResult::maxReportedIssues)
+        return;
+    QueueParseIssue issue;
+    issue.offset = offset;
+    issue.token.assign(begin, std::min<size_t>(end - begin, 32));
+    issue.reason = reason;
+    result.issues.push_back(issue);
+}
+
+void parseQueueBuffer(const char *buffer, size_t length, size_t baseOffset, QueueParseResult &result)
+{
+    const char *p = buffer;
+    const char *end = buffer + length;
+    while (p < end)
+    {
+        while (p < end && isSeparator(*p))
+            ++p;
+        if (p == end)
+            break;
+        const char *tokenBegin = p;
+        while (p < end && !isSeparator(*p))
+            ++p;
+
+        // from_chars rejects a leading '+', which stoi used to accept
+        const char *digits = (*tokenBegin == '+' && p - tokenBegin > 1) ? tokenBegin + 1 : tokenBegin;
+        int value = 0;
+        std::from_chars_result converted = std::from_chars(digits, p, value);
+        if (converted.ec == std::errc() && converted.ptr == p)
+            result.values.push_back(value);
+        else
+            addIssue(result, baseOffset + (tokenBegin - buffer), tokenBegin, p,
+                     converted.ec == std::errc::result_out_of_range ? "out of range" : "not an integer");
+    }
+    result.bytesRead += length;
+}
+
+bool parseQueueStream(std::FILE *stream, QueueParseResult &result, size_t chunkBytes)
+{
+    std::vector<char> buffer(std::max<size_t>(chunkBytes, 64));
+    size_t carried = 0; // Bytes of an unfinished token kept at the front of the buffer
+    size_t offset = result.bytesRead;
+    while (true)
+    {
+        if (carried == buffer.size())
+            buffer.resize(buffer.size() * 2); // One token longer than a chunk
+        size_t got = std::fread(buffer.data() + carried, 1, buffer.size() - carried, stream);
+        size_t filled = carried + got;
+        if (got == 0)
+        {
+            if (std::ferror(stream))
+                return false;
+            parseQueueBuffer(buffer.data(), filled, offset, result); // Last token, if any
+            return true;
+        }
+
+        // Parse up to the last separator; the tail may continue in the next chunk
+        size_t cut = filled;
+        while (cut > 0 && !isSeparator(buffer[cut - 1]))
+            --cut;
+        parseQueueBuffer(buffer.data(), cut, offset, result);
+        offset += cut;
+        carried = filled - cut;
+        std::memmove(buffer.data(), buffer.data() + cut, carried);
+    }
+}
+
+bool parseQueueFile(const std::string &path, QueueParseResult &result, std::string &error)
+{
+    if (path == "-")
+    {
+        if (!parseQueueStream(stdin, result))
+        {
+            error = "error reading standard input";
+            return false;
+        }
+        return true;
+    }
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    if (!file)
+    {
+        error = "cannot open '" + path + "': " + std::strerror(errno);
+        return false;
+    }
+    bool ok = parseQueueStream(file, result);
+    std::fclose(file);
+    if (!ok)
+        error = "error reading '" + path + "'";
+    return ok;
+}
+
+void reportQueueParseIssues(const QueueParseResult &result, std::ostream &out)
+{
+    for (const QueueParseIssue &issue : result.issues)
+        out << "Warning: skipped '" << issue.token << "' at byte " << issue.offset << " (" << issue.reason << ")." << std::endl;
+    if (result.issueCount > result.issues.size())
+        out << "Warning: ... and " << (result.issueCount - result.issues.size()) << " more malformed tokens." << std::endl;
+}
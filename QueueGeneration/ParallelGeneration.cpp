@@ -0,0 +1,208 @@
+#include "../Headers/QueueGeneration.h"
+#include "../Headers/ThreadPool.h"
+#include <cmath>
+#include <algorithm>
+
+// Elements per chunk. Fixed, so chunk boundaries (and with them the output) do not depend
+// on how many threads share the work.
+static const size_t chunkSize = 1 << 16;
+
+Xoshiro256::Xoshiro256(uint64_t seed)
+{
+    for (int i = 0; i < 4; ++i)
+        s[i] = deriveSeed(seed, i);
+}
+
+void Xoshiro256::jump()
+{
+    static const uint64_t polynomial[] = {0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull,
+                                          0xa9582618e03fc9aaull, 0x39abdc4529b1661cull};
+    uint64_t t[4] = {0, 0, 0, 0};
+    for (uint64_t word : polynomial)
+    {
+        for (int b = 0; b < 64; ++b)
+        {
+            if (word & (1ull << b))
+            {
+                for (int i = 0; i < 4; ++i)
+                    t[i] ^= s[i];
+            }
+            (*this)();
+        }
+    }
+    for (int i = 0; i < 4; ++i)
+        s[i] = t[i];
+}
+
+namespace
+{
+    // Cluster layout shared by every chunk: centre c sits in the middle of the c-th equal
+    // segment, nudged by up to 10% of a segment by a hash of (seed, c)
+    struct ClusterLayout
+    {
+        int maxCylinder;
+        int clusters;
+        double segmentWidth;
+        int offsetRange;
+        double stdDev;
+        uint64_t centerSeed;
+
+        ClusterLayout(int maxCylinder, int clusters, uint64_t seed)
+            : maxCylinder(maxCylinder), clusters(clusters),
+              segmentWidth(static_cast<double>(maxCylinder + 1) / clusters),
+              offsetRange(std::max(0, static_cast<int>(std::round(segmentWidth * 0.10)))),
+              stdDev(std::max(1.0, segmentWidth / 6.0)),
+              centerSeed(deriveSeed(seed, ~0ull)) {}
+
+        int center(uint64_t c) const
+        {
+            int ideal = static_cast<int>(std::round((c + 0.5) * segmentWidth));
+            uint64_t span = 2 * static_cast<uint64_t>(offsetRange) + 1;
+            int offset = static_cast<int>(deriveSeed(centerSeed, c) % span) - offsetRange;
+            return std::max(0, std::min(maxCylinder, ideal + offset));
+        }
+
+        int sample(int center, double gaussian) const
+        {
+            int cylinder = static_cast<int>(std::round(center + gaussian * stdDev));
+            return std::max(0, std::min(maxCylinder, cylinder));
+        }
+    };
+
+    // Marsaglia's polar method (no trig calls); the spare value never leaves the chunk
+    struct Gaussian
+    {
+        Xoshiro256 &rng;
+        bool hasSpare = false;
+        double spare = 0.0;
+
+        double operator()()
+        {
+            if (hasSpare)
+            {
+                hasSpare = false;
+                return spare;
+            }
+            double u, v, s;
+            do
+            {
+                u = 2.0 * rng.uniform01() - 1.0;
+                v = 2.0 * rng.uniform01() - 1.0;
+                s = u * u + v * v;
+            } while (s >= 1.0 || s == 0.0);
+            double scale = std::sqrt(-2.0 * std::log(s) / s);
+            spare = v * scale;
+            hasSpare = true;
+            return u * scale;
+        }
+    };
+}
+
+// Fills out[first, last) of a pattern; `rng` is the chunk's own stream
+static void generateChunk(QueuePattern pattern, int maxCylinder, size_t numRequests, const ClusterLayout &layout,
+                          size_t first, size_t last, Xoshiro256 &rng, int *out)
+{
+    uint32_t range = static_cast<uint32_t>(maxCylinder) + 1;
+    Gaussian gaussian{rng};
+    if (pattern == QueuePattern::Clustered)
+    {
+        // Same split as generateClustered(): the first numRequests % clusters clusters get
+        // one extra request
+        uint64_t perCluster = numRequests / layout.clusters;
+        uint64_t extra = numRequests % layout.clusters;
+        uint64_t bigPart = extra * (perCluster + 1);
+        uint64_t cachedCluster = ~0ull;
+        int center = 0;
+        for (size_t i = first; i < last; ++i)
+        {
+            uint64_t c = (i < bigPart) ? i / (perCluster + 1) : extra + (i - bigPart) / perCluster;
+            if (c != cachedCluster)
+            {
+                cachedCluster = c;
+                center = layout.center(c);
+            }
+            out[i] = layout.sample(center, gaussian());
+        }
+    }
+    else if (pattern == QueuePattern::Mixed)
+    {
+        for (size_t i = first; i < last; ++i)
+        {
+            if (rng.uniform01() < 0.6)
+                out[i] = static_cast<int>(rng.below(range));
+            else
+                out[i] = layout.sample(layout.center(rng.below(layout.clusters)), gaussian());
+        }
+    }
+    else
+    {
+        for (size_t i = first; i < last; ++i)
+            out[i] = static_cast<int>(rng.below(range));
+    }
+}
+
+std::vector<int> generatePatternParallel(QueuePattern pattern, int max_cylinder, size_t num_requests, int num_clusters,
+                                         uint64_t seed, ThreadPool *pool, const WorkloadModel *model)
+{
+    max_cylinder = std::max(0, max_cylinder);
+    if (pattern == QueuePattern::Sequential)
+    {
+        std::seed_seq seq{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)};
+        std::mt19937 rng(seq);
+        return generateSequential(max_cylinder, static_cast<int>(std::min<size_t>(num_requests, INT32_MAX)), rng);
+    }
+    std::shared_ptr<const WorkloadModel> defaultModel;
+    if (isSkewedPattern(pattern) && !model)
+    {
+        defaultModel = buildWorkloadModel(pattern, max_cylinder, WorkloadParams());
+        model = defaultModel.get();
+    }
+    if (pattern == QueuePattern::Locality)
+        return generateWorkload(*model, num_requests, seed);
+
+    std::vector<int> queue(num_requests);
+    if (num_requests == 0)
+        return queue;
+    int clusters = 1;
+    if (pattern == QueuePattern::Clustered)
+        clusters = static_cast<int>(std::max<size_t>(1, std::min<size_t>(std::max(1, num_clusters), num_requests)));
+    else if (pattern == QueuePattern::Mixed)
+    {
+        // As generateMixed(): one cluster per five clustered requests
+        size_t clustered = num_requests - num_requests * 6 / 10;
+        clusters = static_cast<int>(std::max<size_t>(1, std::min<size_t>(clustered / 5 + 1, INT32_MAX)));
+    }
+    ClusterLayout layout(max_cylinder, clusters, seed);
+
+    // Chunk starting states are found by jumping once per chunk, in order
+    size_t numChunks = (num_requests + chunkSize - 1) / chunkSize;
+    std::vector<Xoshiro256> streams;
+    streams.reserve(numChunks);
+    Xoshiro256 stream(seed);
+    for (size_t k = 0; k < numChunks; ++k)
+    {
+        streams.push_back(stream);
+        stream.jump();
+    }
+
+    int *out = queue.data();
+    for (size_t k = 0; k < numChunks; ++k)
+    {
+        auto task = [&, k]
+        {
+            size_t first = k * chunkSize;
+            size_t last = std::min(num_requests, first + chunkSize);
+            if (model)
+                generateWorkload(*model, first, last - first, streams[k], out + first);
+            else
+                generateChunk(pattern, max_cylinder, num_requests, layout, first, last, streams[k], out);
+        };
+        if (pool)
+            pool->submit(task);
+        else
+            task();
+    }
+    if (pool)
+        pool->wait();
+    return queue;
+}
@@ -154,3 +154,68 @@ std::vector<int> generateMixed(int max_cylinder, int num_requests, std::mt19937
     std::shuffle(queue.begin(), queue.end(), rng);
     return queue;
 }
+
+std::vector<int> generatePattern(QueuePattern pattern, int max_cylinder, int num_requests, int num_clusters, std::mt19937 &rng)
+{
+    switch (pattern)
+    {
+    case QueuePattern::Sequential:
+        return generateSequential(max_cylinder, num_requests, rng);
+    case QueuePattern::Clustered:
+        return generateClustered(max_cylinder, num_requests, num_clusters, rng);
+    case QueuePattern::Mixed:
+        return generateMixed(max_cylinder, num_requests, rng);
+    case QueuePattern::Zipf:
+    case QueuePattern::HotCold:
+    case QueuePattern::Locality:
+    {
+        // Default parameters; callers that repeat trials should build the model once themselves
+        uint64_t seed = (static_cast<uint64_t>(rng()) << 32) | rng();
+        return generateWorkload(*buildWorkloadModel(pattern, max_cylinder, WorkloadParams()), std::max(0, num_requests), seed);
+    }
+    default:
+        return generateUniformRandom(max_cylinder, num_requests, rng);
+    }
+}
+
+static const std::pair<QueuePattern, const char *> patternNames[] = {
+    {QueuePattern::Uniform, "uniform"},
+    {QueuePattern::Sequential, "sequential"},
+    {QueuePattern::Clustered, "clustered"},
+    {QueuePattern::Mixed, "mixed"},
+    {QueuePattern::Zipf, "zipf"},
+    {QueuePattern::HotCold, "hotcold"},
+    {QueuePattern::Locality, "locality"},
+};
+
+const char *patternName(QueuePattern pattern)
+{
+    for (const auto &entry : patternNames)
+    {
+        if (entry.first == pattern)
+            return entry.second;
+    }
+    return "unknown";
+}
+
+bool parsePatternName(const std::string &name, QueuePattern &pattern)
+{
+    for (const auto &entry : patternNames)
+    {
+        if (name == entry.second)
+        {
+            pattern = entry.first;
+            return true;
+        }
+    }
+    return false;
+}
+
+// SplitMix64 finalizer over (masterSeed, streamIndex): adjacent streams get unrelated seeds
+uint64_t deriveSeed(uint64_t masterSeed, uint64_t streamIndex)
+{
+    uint64_t z = masterSeed + (streamIndex + 1) * 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
@@ -0,0 +1,144 @@
+#include "../Headers/QueueGeneration.h"
+#include <cmath>
+#include <numeric>
+#include <algorithm>
+
+AliasTable::AliasTable(const std::vector<double> &weights)
+{
+    size_t n = weights.size();
+    probability.assign(n, 1.0);
+    alias.resize(n);
+    std::iota(alias.begin(), alias.end(), 0u);
+    double total = std::accumulate(weights.begin(), weights.end(), 0.0);
+    if (n == 0 || total <= 0.0)
+        return;
+
+    // Vose: pair every under-full column with an over-full one that tops it up
+    std::vector<double> scaled(n);
+    std::vector<uint32_t> small, large;
+    for (size_t i = 0; i < n; ++i)
+    {
+        scaled[i] = weights[i] * n / total;
+        (scaled[i] < 1.0 ? small : large).push_back(static_cast<uint32_t>(i));
+    }
+    while (!small.empty() && !large.empty())
+    {
+        uint32_t s = small.back(), l = large.back();
+        small.pop_back();
+        probability[s] = scaled[s];
+        alias[s] = l;
+        scaled[l] -= 1.0 - scaled[s];
+        if (scaled[l] < 1.0)
+        {
+            large.pop_back();
+            small.push_back(l);
+        }
+    }
+    // Whatever is left is full up to rounding error
+    for (uint32_t i : small)
+        probability[i] = 1.0;
+    for (uint32_t i : large)
+        probability[i] = 1.0;
+}
+
+bool isSkewedPattern(QueuePattern pattern)
+{
+    return pattern == QueuePattern::Zipf || pattern == QueuePattern::HotCold || pattern == QueuePattern::Locality;
+}
+
+std::shared_ptr<const WorkloadModel> buildWorkloadModel(QueuePattern pattern, int maxCylinder, const WorkloadParams &params)
+{
+    std::shared_ptr<WorkloadModel> model = std::make_shared<WorkloadModel>();
+    model->pattern = pattern;
+    model->maxCylinder = std::max(0, maxCylinder);
+    model->params = params;
+    uint64_t cylinders = static_cast<uint64_t>(model->maxCylinder) + 1;
+
+    if (pattern == QueuePattern::HotCold)
+    {
+        double hotProbability = std::max(0.0, std::min(1.0, params.hotProbability));
+        model->hotCylinders = static_cast<int>(std::max<double>(1.0, std::min<double>(cylinders, std::round(params.hotFraction * cylinders))));
+        bool hasCold = static_cast<uint64_t>(model->hotCylinders) < cylinders;
+        model->table = AliasTable({hasCold ? hotProbability : 1.0, hasCold ? 1.0 - hotProbability : 0.0});
+    }
+    else if (params.zipfExponent > 0.0)
+    {
+        std::vector<double> weights(cylinders);
+        for (uint64_t k = 0; k < cylinders; ++k)
+            weights[k] = std::pow(static_cast<double>(k + 1), -params.zipfExponent);
+        model->table = AliasTable(weights);
+    }
+
+    // Popular ranks are spread over the disk, not packed at cylinder 0: a stride near the
+    // golden ratio and coprime with the cylinder count makes rank -> cylinder a permutation,
+    // and the base puts the hottest rank mid-disk rather than at an edge SCAN sweeps anyway
+    model->base = cylinders / 2;
+    uint64_t stride = std::max<uint64_t>(1, static_cast<uint64_t>(cylinders * 0.6180339887));
+    while (std::gcd(stride, cylinders) != 1)
+        stride++;
+    model->stride = stride % cylinders == 0 ? 1 : stride;
+    model->driftStep = static_cast<uint64_t>(std::max(1.0, std::round(params.driftFraction * cylinders)));
+    return model;
+}
+
+// Offset of the hot set for request `index`
+static uint64_t driftShift(const WorkloadModel &model, size_t index, uint64_t cylinders)
+{
+    if (model.params.driftInterval <= 0)
+        return 0;
+    return (index / static_cast<uint64_t>(model.params.driftInterval)) % cylinders * model.driftStep % cylinders;
+}
+
+static int popularCylinder(const WorkloadModel &model, Xoshiro256 &rng, uint64_t shift, uint64_t cylinders)
+{
+    if (model.table.size() == 0)
+        return static_cast<int>(rng.below(static_cast<uint32_t>(cylinders)));
+    uint64_t rank = model.table.sample(rng);
+    return static_cast<int>((model.base + rank * model.stride + shift) % cylinders);
+}
+
+void generateWorkload(const WorkloadModel &model, size_t first, size_t count, Xoshiro256 &rng, int *out)
+{
+    uint64_t cylinders = static_cast<uint64_t>(model.maxCylinder) + 1;
+    if (model.pattern == QueuePattern::HotCold)
+    {
+        // The hot band starts centred on the disk
+        uint64_t hot = model.hotCylinders;
+        uint64_t bandStart = (cylinders - hot) / 2;
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint64_t start = bandStart + driftShift(model, first + i, cylinders);
+            uint64_t offset = model.table.sample(rng) == 0 ? rng.below(static_cast<uint32_t>(hot))
+                                                           : hot + rng.below(static_cast<uint32_t>(cylinders - hot));
+            out[i] = static_cast<int>((start + offset) % cylinders);
+        }
+    }
+    else if (model.pattern == QueuePattern::Locality)
+    {
+        // Each request continues the current run with probability 1 - 1/L, so run lengths are
+        // geometric with mean L; a new run starts at a popular cylinder
+        double endRun = 1.0 / std::max(1.0, model.params.meanRunLength);
+        int current = -1;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (current < 0 || current >= model.maxCylinder || rng.uniform01() < endRun)
+                current = popularCylinder(model, rng, driftShift(model, first + i, cylinders), cylinders);
+            else
+                current++;
+            out[i] = current;
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = popularCylinder(model, rng, driftShift(model, first + i, cylinders), cylinders);
+    }
+}
+
+std::vector<int> generateWorkload(const WorkloadModel &model, size_t numRequests, uint64_t seed)
+{
+    std::vector<int> queue(numRequests);
+    Xoshiro256 rng(seed);
+    generateWorkload(model, 0, numRequests, rng, queue.data());
+    return queue;
+}
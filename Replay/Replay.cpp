@@ -0,0 +1,658 @@
+#include "../Headers/Replay.h"
+#include "../Headers/SchedulerSinks.h"
+#include "../Headers/ThreadPool.h"
+#include <charconv>
+#include <cstring>
+#include <cerrno>
+#include <cmath>
+#include <climits>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+
+// struct blk_io_trace from the kernel's blktrace_api.h: 48 bytes, then pdu_len bytes of payload
+static const size_t blkRecordBytes = 48;
+static const uint32_t blkMagic = 0x65617400; // "eat", low byte is the version
+static const uint32_t blkCategoryWrite = 1u << 1;    // BLK_TC_WRITE
+static const uint32_t blkCategoryNotify = 1u << 10;  // BLK_TC_NOTIFY
+static const uint32_t blkCategoryDiscard = 1u << 13; // BLK_TC_DISCARD
+static const int blkCategoryShift = 16;
+
+static const char *const replayAlgorithms[] = {"FCFS", "SSTF", "SCAN", "C-SCAN", "LOOK", "C-LOOK", "HDSA",
+                                               "MQ-DL", "FSCAN", "N-SCAN", "SPTF"};
+
+// blkparse action letter -> __BLK_TA_* code
+static bool actionCodeFor(char action, uint32_t &code)
+{
+    switch (action)
+    {
+    case 'Q':
+        code = 1;
+        return true;
+    case 'I':
+        code = 12;
+        return true;
+    case 'D':
+        code = 7;
+        return true;
+    case 'C':
+        code = 8;
+        return true;
+    default:
+        return false;
+    }
+}
+
+static uint32_t byteSwap32(uint32_t v)
+{
+    return (v >> 24) | ((v >> 8) & 0xFF00) | ((v << 8) & 0xFF0000) | (v << 24);
+}
+
+static uint64_t byteSwap64(uint64_t v)
+{
+    return (static_cast<uint64_t>(byteSwap32(static_cast<uint32_t>(v))) << 32) | byteSwap32(static_cast<uint32_t>(v >> 32));
+}
+
+bool parseBlockTraceFormat(const std::string &name, BlockTraceFormat &format)
+{
+    if (name == "auto")
+        format = BlockTraceFormat::Auto;
+    else if (name == "text")
+        format = BlockTraceFormat::Text;
+    else if (name == "binary")
+        format = BlockTraceFormat::Binary;
+    else
+        return false;
+    return true;
+}
+
+BlockTraceReader::~BlockTraceReader()
+{
+    if (file && file != stdin)
+        std::fclose(file);
+}
+
+bool BlockTraceReader::open(const std::string &path, BlockTraceFormat format, char traceAction, std::string &error)
+{
+    if (!actionCodeFor(traceAction, actionCode))
+    {
+        error = std::string("unsupported action '") + traceAction + "' (use Q, I, D or C)";
+        return false;
+    }
+    action = traceAction;
+    file = (path == "-") ? stdin : std::fopen(path.c_str(), "rb");
+    if (!file)
+    {
+        error = "cannot open '" + path + "': " + std::strerror(errno);
+        return false;
+    }
+    buffer.assign(1 << 20, 0);
+    begin = end = 0;
+    eof = false;
+
+    // Sniff the byte order from the first record's magic
+    fill(4);
+    uint32_t magic = 0;
+    if (end - begin >= 4)
+        std::memcpy(&magic, buffer.data() + begin, 4);
+    bool native = (magic & 0xFFFFFF00) == blkMagic;
+    bool swapped = (byteSwap32(magic) & 0xFFFFFF00) == blkMagic;
+    isBinary = format == BlockTraceFormat::Binary || (format == BlockTraceFormat::Auto && (native || swapped));
+    swapBytes = swapped && !native;
+    if (isBinary && !native && !swapped)
+    {
+        error = "'" + path + "' is not a blktrace binary trace";
+        return false;
+    }
+    return true;
+}
+
+// Makes at least `bytes` unread bytes available unless the file ends first
+bool BlockTraceReader::fill(size_t bytes)
+{
+    while (end - begin < bytes && !eof)
+    {
+        if (begin > 0)
+        {
+            std::memmove(buffer.data(), buffer.data() + begin, end - begin);
+            end -= begin;
+            begin = 0;
+        }
+        if (end == buffer.size())
+            buffer.resize(buffer.size() * 2); // A single line or record larger than the buffer
+        size_t got = std::fread(buffer.data() + end, 1, buffer.size() - end, file);
+        if (got == 0)
+            eof = true;
+        end += got;
+    }
+    return end - begin >= bytes;
+}
+
+bool BlockTraceReader::nextLine(const char *&line, size_t &length)
+{
+    size_t scanned = 0;
+    while (true)
+    {
+        const char *start = buffer.data() + begin;
+        const char *newline = static_cast<const char *>(std::memchr(start + scanned, '\n', end - begin - scanned));
+        if (newline)
+        {
+            line = start;
+            length = newline - start;
+            begin += length + 1;
+            return true;
+        }
+        if (eof)
+        {
+            if (end == begin)
+                return false;
+            line = start;
+            length = end - begin;
+            begin = end;
+            return true;
+        }
+        scanned = end - begin;
+        fill(scanned + 1);
+    }
+}
+
+bool BlockTraceReader::nextText(BlockTraceEvent &event)
+{
+    const char *line;
+    size_t length;
+    while (nextLine(line, length))
+    {
+        recordsRead++;
+        // dev cpu seq time pid action rwbs sector + blocks [process]
+        const char *field[10];
+        const char *fieldEnd[10];
+        int fields = 0;
+        const char *p = line, *stop = line + length;
+        while (fields < 10)
+        {
+            while (p < stop && (*p == ' ' || *p == '\t' || *p == '\r'))
+                ++p;
+            if (p == stop)
+                break;
+            field[fields] = p;
+            while (p < stop && *p != ' ' && *p != '\t' && *p != '\r')
+                ++p;
+            fieldEnd[fields++] = p;
+        }
+        // Summary sections, plug/unplug and message lines are not I/O of this action
+        if (fields < 6 || fieldEnd[5] - field[5] != 1 || *field[5] != action)
+            continue;
+        double seconds = 0.0;
+        uint64_t lba = 0;
+        uint32_t blocks = 0;
+        if (fields < 10 || fieldEnd[8] - field[8] != 1 || *field[8] != '+' ||
+            std::from_chars(field[3], fieldEnd[3], seconds).ec != std::errc() ||
+            std::from_chars(field[7], fieldEnd[7], lba).ec != std::errc() ||
+            std::from_chars(field[9], fieldEnd[9], blocks).ec != std::errc())
+        {
+            malformed++;
+            continue;
+        }
+        bool write = std::find(field[6], fieldEnd[6], 'W') != fieldEnd[6];
+        bool read = std::find(field[6], fieldEnd[6], 'R') != fieldEnd[6];
+        if ((!write && !read) || blocks == 0)
+            continue; // Flushes, discards without data, zero-length barriers
+        event.timeMs = seconds * 1000.0;
+        event.lba = lba;
+        event.sectors = blocks;
+        event.isWrite = write;
+        return true;
+    }
+    return false;
+}
+
+bool BlockTraceReader::nextBinary(BlockTraceEvent &event)
+{
+    while (fill(blkRecordBytes))
+    {
+        const char *r = buffer.data() + begin;
+        uint32_t magic, bytes, traceAction;
+        uint64_t time, sector;
+        uint16_t pduLength;
+        std::memcpy(&magic, r, 4);
+        std::memcpy(&time, r + 8, 8);
+        std::memcpy(&sector, r + 16, 8);
+        std::memcpy(&bytes, r + 24, 4);
+        std::memcpy(&traceAction, r + 28, 4);
+        std::memcpy(&pduLength, r + 46, 2);
+        if (swapBytes)
+        {
+            magic = byteSwap32(magic);
+            time = byteSwap64(time);
+            sector = byteSwap64(sector);
+            bytes = byteSwap32(bytes);
+            traceAction = byteSwap32(traceAction);
+            pduLength = static_cast<uint16_t>((pduLength >> 8) | (pduLength << 8));
+        }
+        recordsRead++;
+        if ((magic & 0xFFFFFF00) != blkMagic)
+        {
+            malformed++; // Lost framing: nothing after this can be trusted
+            begin = end;
+            eof = true;
+            return false;
+        }
+        if (!fill(blkRecordBytes + pduLength))
+        {
+            malformed++; // Truncated last record
+            return false;
+        }
+        begin += blkRecordBytes + pduLength;
+
+        // Discards move no data, like the text path's rwbs without R or W
+        uint32_t category = traceAction >> blkCategoryShift;
+        if ((traceAction & 0xFFFF) != actionCode || (category & (blkCategoryNotify | blkCategoryDiscard)) || bytes == 0)
+            continue;
+        event.timeMs = time / 1e6;
+        event.lba = sector;
+        event.sectors = (bytes + 511) / 512;
+        event.isWrite = (category & blkCategoryWrite) != 0;
+        return true;
+    }
+    return false;
+}
+
+bool BlockTraceReader::next(BlockTraceEvent &event)
+{
+    return isBinary ? nextBinary(event) : nextText(event);
+}
+
+namespace
+{
+    // Everything one algorithm carries from window to window
+    struct AlgorithmState
+    {
+        std::string name;
+        MetricsAccumulator accumulator;
+        int head;
+        double clockMs = 0.0;
+        double responseSumMs = 0.0;
+        double responseMaxMs = 0.0;
+        long long responded = 0;
+        long long unserved = 0;
+        LatencyHistogram responseUs;
+
+        AlgorithmState(const std::string &name, const DiskPerformanceParams &params, int head)
+            : name(name), accumulator(params), head(head) {}
+    };
+
+    // Every window's sequence opens with the head where the previous window left it. The
+    // accumulator is already standing there, so that stop is dropped for it rather than
+    // counted as an extra zero-length step; the window's own tracker still needs it.
+    struct WindowSink
+    {
+        MetricsAccumulator &accumulator;
+        ResponseTimeTracker &tracker;
+        bool skipFirst;
+        int last;
+        void push(int cylinder)
+        {
+            tracker.push(cylinder);
+            last = cylinder;
+            if (skipFirst)
+            {
+                skipFirst = false;
+                return;
+            }
+            accumulator.push(cylinder);
+        }
+    };
+}
+
+// The arrival-aware schedulers pick up the service clock where the previous window left it,
+// so requests that arrived while the disk was still busy are eligible from the start
+template <typename Sink>
+static void scheduleWindow(const std::string &name, int startHead, double startClockMs, int maxCylinder,
+                           const std::vector<int> &queue, const std::vector<Request> &requests,
+                           const DiskPerformanceParams &params, const FairSchedulingParams &fair, Sink &sink)
+{
+    if (name == "FCFS")
+        fcfsTo(startHead, queue, sink);
+    else if (name == "SSTF")
+        sstfTo(startHead, buildSstfTable(queue), sink);
+    else if (name == "MQ-DL")
+        mqDeadlineTo(startHead, requests, params, fair, sink, startClockMs);
+    else if (name == "FSCAN")
+        fscanTo(startHead, requests, params, sink, startClockMs);
+    else if (name == "N-SCAN")
+        nstepScanTo(startHead, requests, params, fair.nStep, sink, startClockMs);
+    else if (name == "SPTF")
+        sptfTo(startHead, requests, params, sink, startClockMs);
+    else
+    {
+        PreparedQueue prepared = prepareQueue(startHead, queue);
+        if (name == "SCAN")
+            scanTo(prepared, maxCylinder, sink);
+        else if (name == "C-SCAN")
+            cscanTo(prepared, maxCylinder, sink);
+        else if (name == "LOOK")
+            lookTo(prepared, sink);
+        else if (name == "C-LOOK")
+            clookTo(prepared, sink);
+        else
+            hdsaTo(prepared, sink);
+    }
+}
+
+static void runWindow(AlgorithmState &state, const std::vector<int> &queue, const std::vector<Request> &window,
+                      const ReplayConfig &config, const DiskPerformanceParams &params, bool firstWindow)
+{
+    ResponseTimeTracker tracker(window, params, state.clockMs);
+    WindowSink sink{state.accumulator, tracker, !firstWindow, state.head};
+    scheduleWindow(state.name, state.head, state.clockMs, config.geometry.maxCylinder, queue, window, params,
+                   config.fairParams, sink);
+    state.head = sink.last;
+    state.clockMs = tracker.clock();
+
+    const std::vector<double> &completions = tracker.completionTimesMs();
+    for (size_t i = 0; i < window.size(); ++i)
+    {
+        if (std::isnan(completions[i]))
+        {
+            state.unserved++;
+            continue;
+        }
+        double response = completions[i] - window[i].arrivalMs;
+        state.responseSumMs += response;
+        state.responseMaxMs = std::max(state.responseMaxMs, response);
+        state.responseUs.record(static_cast<unsigned long long>(std::llround(std::max(0.0, response) * 1000.0)));
+        state.responded++;
+    }
+}
+
+bool replayTrace(const ReplayConfig &config, std::vector<ReplayResult> &results, ReplayStats &stats, std::string &error)
+{
+    const ReplayGeometry &geometry = config.geometry;
+    if (geometry.sectorsPerTrack < 1 || geometry.heads < 1 || geometry.maxCylinder < 0 ||
+        config.startHead < 0 || config.startHead > geometry.maxCylinder)
+    {
+        error = "invalid geometry or start head";
+        return false;
+    }
+    std::vector<std::string> names = config.algorithms;
+    if (names.empty())
+        names.assign(std::begin(replayAlgorithms), std::end(replayAlgorithms));
+    for (std::string &name : names)
+    {
+        std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c)
+                       { return static_cast<char>(std::toupper(c)); });
+        if (std::find(std::begin(replayAlgorithms), std::end(replayAlgorithms), name) == std::end(replayAlgorithms))
+        {
+            error = "unknown algorithm '" + name + "'";
+            return false;
+        }
+    }
+
+    // Per-request transfer comes from each request's own size
+    DiskPerformanceParams params = deriveDiskParams(config.seekTimeMs, config.rpm, config.transferRateMBps, 4.0);
+    if (config.rotational)
+        params.geometry = makeDiskGeometry(geometry.sectorsPerTrack, config.rpm);
+    if (!config.seekProfilePath.empty() || !config.seekCurveSpec.empty())
+    {
+        params.seekCurve = !config.seekProfilePath.empty() ? loadSeekProfile(config.seekProfilePath, geometry.maxCylinder, error)
+                                                           : parseSeekCurveSpec(config.seekCurveSpec, geometry.maxCylinder, error);
+        if (!params.seekCurve)
+            return false;
+    }
+
+    BlockTraceReader reader;
+    if (!reader.open(config.tracePath, config.format, config.action, error))
+        return false;
+
+    std::vector<AlgorithmState> states;
+    states.reserve(names.size());
+    for (const std::string &name : names)
+        states.emplace_back(name, params, config.startHead);
+
+    // Windows are scheduled by all algorithms side by side; the next window is only read
+    // once they are done with this one, so memory stays at one window
+    ThreadPool pool(config.numThreads);
+    size_t windowSize = std::max<size_t>(1, config.windowRequests);
+    std::vector<Request> window;
+    std::vector<int> queue;
+    window.reserve(windowSize);
+    auto flush = [&]()
+    {
+        if (window.empty())
+            return;
+        queue.resize(window.size());
+        for (size_t i = 0; i < window.size(); ++i)
+            queue[i] = window[i].cylinder;
+        bool firstWindow = stats.windows == 0;
+        for (AlgorithmState &state : states)
+            pool.submit([&, firstWindow]
+                        { runWindow(state, queue, window, config, params, firstWindow); });
+        pool.wait();
+        stats.windows++;
+        window.clear();
+    };
+
+    uint64_t sectorsPerCylinder = static_cast<uint64_t>(geometry.sectorsPerTrack) * geometry.heads;
+    BlockTraceEvent event;
+    bool haveOrigin = false;
+    double originMs = 0.0, lastArrivalMs = 0.0;
+    while ((config.limit <= 0 || stats.requests < config.limit) && reader.next(event))
+    {
+        if (!haveOrigin)
+        {
+            haveOrigin = true;
+            originMs = event.timeMs;
+        }
+        // Per-CPU streams can be slightly out of order; arrivals must not go backwards
+        double arrivalMs = std::max(lastArrivalMs, event.timeMs - originMs);
+        lastArrivalMs = arrivalMs;
+        if (config.windowMs > 0.0 && !window.empty() && arrivalMs - window.front().arrivalMs >= config.windowMs)
+            flush();
+
+        Request request;
+        request.id = static_cast<int>(window.size());
+        request.arrivalMs = arrivalMs;
+        uint64_t cylinder = event.lba / sectorsPerCylinder;
+        if (cylinder > static_cast<uint64_t>(geometry.maxCylinder))
+        {
+            cylinder = geometry.maxCylinder;
+            stats.clamped++;
+        }
+        request.cylinder = static_cast<int>(cylinder);
+        request.sizeKB = event.sectors * 0.5;
+        request.isWrite = event.isWrite;
+        if (config.rotational)
+            request.sector = static_cast<int>(event.lba % geometry.sectorsPerTrack);
+        window.push_back(request);
+        stats.requests++;
+        if (window.size() >= windowSize)
+            flush();
+    }
+    flush();
+    stats.traceSpanMs = lastArrivalMs;
+    if (reader.malformed > 0)
+        std::cerr << "Warning: " << reader.malformed << " malformed " << (reader.binary() ? "records" : "lines")
+                  << " in the trace were skipped." << std::endl;
+
+    results.clear();
+    int numRequests = static_cast<int>(std::min<long long>(stats.requests, INT_MAX));
+    for (AlgorithmState &state : states)
+    {
+        ReplayResult result;
+        result.metrics = state.accumulator.result(state.name, numRequests);
+        result.metrics.meanResponseMs = state.responded > 0 ? state.responseSumMs / state.responded : 0.0;
+        result.metrics.maxResponseMs = state.responseMaxMs;
+        result.responsePercentiles = summarizeHistogram(state.responseUs, 0.001);
+        result.unserved = state.unserved;
+        results.push_back(result);
+    }
+    return true;
+}
+
+void printReplayUsage(std::ostream &out)
+{
+    out << "Usage: main --replay --input TRACE [options]\n"
+        << "Replays a block I/O trace through the schedulers in bounded windows.\n"
+        << "  --input FILE           blkparse text output or blktrace binary ('-' = stdin)\n"
+        << "  --format NAME          auto, text or binary (default auto)\n"
+        << "  --action C             Trace action used as arrivals: Q, I, D or C (default Q)\n"
+        << "  --sectors-per-track N  Geometry: 512-byte sectors per track (default 63)\n"
+        << "  --heads N              Geometry: tracks per cylinder (default 16)\n"
+        << "  --cylinders N          Max cylinder; LBAs past it are clamped (default 65535)\n"
+        << "  --head N               Start head position (default 0)\n"
+        << "  --window N             Requests per scheduling window (default 4096)\n"
+        << "  --window-ms X          Also close a window once it spans X ms of trace time (default 0 = off)\n"
+        << "  --limit N              Stop after N requests (default 0 = whole trace)\n"
+        << "  --algorithms LIST      Subset of FCFS, SSTF, SCAN, C-SCAN, LOOK, C-LOOK, HDSA, MQ-DL,\n"
+        << "                         FSCAN, N-SCAN, SPTF (default all)\n"
+        << "  --seek-ms X            Seek time per cylinder in ms (default 0.1)\n"
+        << "  --seek-curve S,A,B,K   Non-linear seek curve, as in batch mode\n"
+        << "  --seek-profile FILE    Measured seek times, 'distance time_ms' per line\n"
+        << "  --rpm X                Rotational speed (default 7200)\n"
+        << "  --transfer-mbps X      Transfer rate in MB/s (default 100)\n"
+        << "  --rotational 0|1       Exact rotational delay from each LBA's sector (default 1)\n"
+        << "  --nstep N              N-step SCAN group size (default 16)\n"
+        << "  --read-expire-ms X     mq-deadline read expiry (default 500)\n"
+        << "  --write-expire-ms X    mq-deadline write expiry (default 5000)\n"
+        << "  --fifo-batch N         mq-deadline batch size (default 16)\n"
+        << "  --writes-starved N     mq-deadline read batches before writes (default 2)\n"
+        << "  --threads N            Worker threads, 0 = all cores (default 0)\n"
+        << "  --output FILE          CSV output path (default stdout)\n";
+}
+
+int replayMain(int argc, char *argv[])
+{
+    ReplayConfig config;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--replay")
+            continue;
+        if (arg == "--help")
+        {
+            printReplayUsage(std::cout);
+            return 0;
+        }
+        if (arg.rfind("--", 0) != 0 || i + 1 >= argc)
+        {
+            std::cerr << "Error: expected '--option value', got '" << arg << "'" << std::endl;
+            printReplayUsage(std::cerr);
+            return 1;
+        }
+        std::string key = arg.substr(2), value = argv[++i];
+        bool ok = true;
+        if (key == "input")
+            config.tracePath = value;
+        else if (key == "format")
+            ok = parseBlockTraceFormat(value, config.format);
+        else if (key == "action")
+        {
+            config.action = value.empty() ? '?' : static_cast<char>(std::toupper(static_cast<unsigned char>(value[0])));
+            ok = value.size() == 1;
+        }
+        else if (key == "sectors-per-track")
+            config.geometry.sectorsPerTrack = std::atoi(value.c_str());
+        else if (key == "heads")
+            config.geometry.heads = std::atoi(value.c_str());
+        else if (key == "cylinders")
+            config.geometry.maxCylinder = std::atoi(value.c_str());
+        else if (key == "head")
+            config.startHead = std::atoi(value.c_str());
+        else if (key == "window")
+            config.windowRequests = std::strtoul(value.c_str(), nullptr, 10);
+        else if (key == "window-ms")
+            config.windowMs = std::atof(value.c_str());
+        else if (key == "limit")
+            config.limit = std::atoll(value.c_str());
+        else if (key == "algorithms")
+        {
+            config.algorithms.clear();
+            std::stringstream ss(value);
+            std::string name;
+            while (std::getline(ss, name, ','))
+                config.algorithms.push_back(name);
+        }
+        else if (key == "seek-ms")
+            config.seekTimeMs = std::atof(value.c_str());
+        else if (key == "seek-curve")
+            config.seekCurveSpec = value;
+        else if (key == "seek-profile")
+            config.seekProfilePath = value;
+        else if (key == "rpm")
+            config.rpm = std::atof(value.c_str());
+        else if (key == "transfer-mbps")
+            config.transferRateMBps = std::atof(value.c_str());
+        else if (key == "rotational")
+            config.rotational = std::atoi(value.c_str()) != 0;
+        else if (key == "nstep")
+            config.fairParams.nStep = std::max(1, std::atoi(value.c_str()));
+        else if (key == "read-expire-ms")
+            config.fairParams.readExpireMs = std::atof(value.c_str());
+        else if (key == "write-expire-ms")
+            config.fairParams.writeExpireMs = std::atof(value.c_str());
+        else if (key == "fifo-batch")
+            config.fairParams.fifoBatch = std::max(1, std::atoi(value.c_str()));
+        else if (key == "writes-starved")
+            config.fairParams.writesStarved = std::max(0, std::atoi(value.c_str()));
+        else if (key == "threads")
+            config.numThreads = std::strtoul(value.c_str(), nullptr, 10);
+        else if (key == "output")
+            config.outputPath = value;
+        else
+            ok = false;
+        if (!ok)
+        {
+            std::cerr << "Error: invalid option '--" << key << " " << value << "'" << std::endl;
+            printReplayUsage(std::cerr);
+            return 1;
+        }
+    }
+    if (config.tracePath.empty() || config.rpm <= 0.0 || config.transferRateMBps <= 0.0)
+    {
+        std::cerr << "Error: --input is required, and rpm and transfer rate must be positive." << std::endl;
+        printReplayUsage(std::cerr);
+        return 1;
+    }
+
+    std::vector<ReplayResult> results;
+    ReplayStats stats;
+    std::string error;
+    auto wallBegin = std::chrono::steady_clock::now();
+    if (!replayTrace(config, results, stats, error))
+    {
+        std::cerr << "Error: " << error << std::endl;
+        return 1;
+    }
+    double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wallBegin).count();
+
+    std::ofstream file;
+    if (!config.outputPath.empty())
+    {
+        file.open(config.outputPath);
+        if (!file)
+        {
+            std::cerr << "Error: cannot write '" << config.outputPath << "'." << std::endl;
+            return 1;
+        }
+    }
+    std::ostream &out = config.outputPath.empty() ? std::cout : file;
+    out << "algorithm,requests,total_movement,avg_seek,max_seek,stddev_seek,avg_service_ms,mean_response_ms,"
+           "p50_response_ms,p99_response_ms,p999_response_ms,max_response_ms,unserved\n";
+    out << std::setprecision(10);
+    for (const ReplayResult &r : results)
+    {
+        const AlgorithmResult &m = r.metrics;
+        out << m.name << "," << stats.requests << "," << m.totalMovement << "," << m.avgSeek << "," << m.maxSeek << ","
+            << m.stdDevSeek << "," << m.avgResponseTime << "," << m.meanResponseMs << "," << r.responsePercentiles.p50 << ","
+            << r.responsePercentiles.p99 << "," << r.responsePercentiles.p999 << "," << m.maxResponseMs << ","
+            << r.unserved << "\n";
+    }
+    if (stats.clamped > 0)
+        std::cerr << "Warning: " << stats.clamped << " requests were beyond cylinder " << config.geometry.maxCylinder
+                  << " and were clamped to it." << std::endl;
+    std::cerr << "Replay: " << stats.requests << " requests over " << std::fixed << std::setprecision(1)
+              << stats.traceSpanMs << " ms of trace in " << stats.windows << " windows, " << wallMs << " ms." << std::endl;
+    return 0;
+}
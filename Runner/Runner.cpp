@@ -0,0 +1,136 @@
+#include "../Headers/Runner.h"
+#include "../Headers/SchedulerSinks.h"
+#include <chrono>
+#include <ctime>
+
+double threadCpuTimeMs()
+{
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+#else
+    // No per-thread CPU clock on this platform: fall back to wall time per job
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// Distance metrics only, or distance plus per-request response times when requests are given
+template <typename Schedule>
+static AlgorithmResult runJob(const std::string &name, int numRequests, const DiskPerformanceParams &diskParams,
+                              const std::vector<Request> *requests, const MetricsOptions &options, Schedule &&schedule)
+{
+    if (requests)
+        return scheduleTimedMetrics(name, *requests, diskParams, schedule, options);
+    return scheduleMetrics(name, numRequests, diskParams, schedule, options);
+}
+
+std::vector<AlgorithmJob> standardAlgorithmJobs(int startHead, int maxCylinder,
+                                                const std::vector<int> &queue,
+                                                const PreparedQueue &preparedQueue,
+                                                const DiskPerformanceParams &diskParams,
+                                                const std::vector<Request> *requests,
+                                                const MetricsOptions &metricsOptions,
+                                                const FairSchedulingParams &fairParams)
+{
+    int numRequests = static_cast<int>(queue.size());
+    const std::vector<int> *q = &queue;
+    const PreparedQueue *pq = &preparedQueue;
+    DiskPerformanceParams params = diskParams;
+    MetricsOptions options = metricsOptions;
+    FairSchedulingParams fair = fairParams;
+
+    std::vector<AlgorithmJob> jobs;
+    jobs.push_back({"FCFS", [=]
+                    { return runJob("FCFS", numRequests, params, requests, options, [&](auto &sink)
+                                    { fcfsTo(startHead, *q, sink); }); }});
+
+    // SSTF works on a compressed table of its own, which also keeps each cylinder's first index
+    jobs.push_back({"SSTF", [=]
+                    { return runJob("SSTF", numRequests, params, requests, options, [&](auto &sink)
+                                    { sstfTo(startHead, buildSstfTable(*q), sink); }); }});
+
+    // Dense queues run the elevators and HDSA as (cylinder, count) runs: they cost
+    // O(distinct cylinders) and the metrics take each run's zero-length seeks in one step.
+    // The runs come from one pass over the sorted queue, which also gives the density test.
+    // withQueue hands the chosen form to a scheduler as its leading arguments, either
+    // (prepared) or (startHead, runs); the sequence is only expanded when
+    // options.storeSequence asks for it.
+    std::shared_ptr<const CompressedQueue> runs;
+    CompressedQueue compressed = compressSorted(preparedQueue.sorted);
+    if (isDenseQueue(compressed))
+        runs = std::make_shared<const CompressedQueue>(std::move(compressed));
+    auto withQueue = [startHead, pq, runs](auto &&schedule)
+    {
+        if (runs)
+            schedule(startHead, *runs);
+        else
+            schedule(*pq);
+    };
+    jobs.push_back({"SCAN", [=]
+                    { return runJob("SCAN", numRequests, params, requests, options, [&](auto &sink)
+                                    { withQueue([&](const auto &...queue)
+                                                { scanTo(queue..., maxCylinder, sink); }); }); }});
+    jobs.push_back({"C-SCAN", [=]
+                    { return runJob("C-SCAN", numRequests, params, requests, options, [&](auto &sink)
+                                    { withQueue([&](const auto &...queue)
+                                                { cscanTo(queue..., maxCylinder, sink); }); }); }});
+    jobs.push_back({"LOOK", [=]
+                    { return runJob("LOOK", numRequests, params, requests, options, [&](auto &sink)
+                                    { withQueue([&](const auto &...queue)
+                                                { lookTo(queue..., sink); }); }); }});
+    jobs.push_back({"C-LOOK", [=]
+                    { return runJob("C-LOOK", numRequests, params, requests, options, [&](auto &sink)
+                                    { withQueue([&](const auto &...queue)
+                                                { clookTo(queue..., sink); }); }); }});
+    jobs.push_back({"HDSA", [=]
+                    { return runJob("HDSA", numRequests, params, requests, options, [&](auto &sink)
+                                    { withQueue([&](const auto &...queue)
+                                                { hdsaTo(queue..., sink); }); }); }});
+    if (!requests)
+        return jobs;
+
+    // Starvation-bounded schedulers need arrival times
+    jobs.push_back({"MQ-DL", [=]
+                    { return runJob("MQ-DL", numRequests, params, requests, options, [&](auto &sink)
+                                    { mqDeadlineTo(startHead, *requests, params, fair, sink); }); }});
+    jobs.push_back({"FSCAN", [=]
+                    { return runJob("FSCAN", numRequests, params, requests, options, [&](auto &sink)
+                                    { fscanTo(startHead, *requests, params, sink); }); }});
+    jobs.push_back({"N-SCAN", [=]
+                    { return runJob("N-SCAN", numRequests, params, requests, options, [&](auto &sink)
+                                    { nstepScanTo(startHead, *requests, params, fair.nStep, sink); }); }});
+    jobs.push_back({"SPTF", [=]
+                    { return runJob("SPTF", numRequests, params, requests, options, [&](auto &sink)
+                                    { sptfTo(startHead, *requests, params, sink); }); }});
+    return jobs;
+}
+
+std::vector<AlgorithmResult> runAlgorithmSuite(const std::vector<AlgorithmJob> &jobs, ThreadPool &pool, SuiteTiming *timing)
+{
+    std::vector<AlgorithmResult> results(jobs.size());
+    std::vector<double> cpuMs(jobs.size(), 0.0);
+
+    auto wallBegin = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < jobs.size(); ++i)
+    {
+        // Each job writes only its own slot, so display order is kept without locking
+        pool.submit([&, i]
+                    {
+                        double cpuBegin = threadCpuTimeMs();
+                        results[i] = jobs[i].run();
+                        cpuMs[i] = threadCpuTimeMs() - cpuBegin; });
+    }
+    pool.wait();
+    auto wallEnd = std::chrono::steady_clock::now();
+
+    if (timing)
+    {
+        timing->wallMs = std::chrono::duration<double, std::milli>(wallEnd - wallBegin).count();
+        timing->cpuMs = 0.0;
+        for (double ms : cpuMs)
+            timing->cpuMs += ms;
+        timing->numThreads = pool.size();
+    }
+    return results;
+}
@@ -0,0 +1,102 @@
+#include "../Headers/ThreadPool.h"
+
+// Which pool/worker the current thread belongs to, so nested submits stay local
+static thread_local const ThreadPool *currentPool = nullptr;
+static thread_local size_t currentWorker = 0;
+
+ThreadPool::ThreadPool(size_t numThreads)
+{
+    if (numThreads == 0)
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t i = 0; i < numThreads; ++i)
+        queues.push_back(std::make_unique<WorkQueue>());
+    workers.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i)
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    taskAvailable.notify_all();
+    for (std::thread &worker : workers)
+        worker.join();
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+    size_t target = (currentPool == this) ? currentWorker : nextQueue++ % queues.size();
+    // Count the task before it becomes visible: a worker could otherwise take and finish it,
+    // dropping queued below zero or pending to zero while wait() is watching
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        pending++;
+        queued++;
+    }
+    {
+        std::lock_guard<std::mutex> lock(queues[target]->mutex);
+        queues[target]->tasks.push_back(std::move(task));
+    }
+    taskAvailable.notify_one();
+}
+
+void ThreadPool::wait()
+{
+    std::unique_lock<std::mutex> lock(stateMutex);
+    allDone.wait(lock, [this]
+                 { return pending == 0; });
+}
+
+bool ThreadPool::takeTask(size_t index, std::function<void()> &task)
+{
+    // Own deque first (newest task, still warm in cache), then steal the oldest elsewhere
+    for (size_t k = 0; k < queues.size(); ++k)
+    {
+        WorkQueue &queue = *queues[(index + k) % queues.size()];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty())
+                continue;
+            if (k == 0)
+            {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            }
+            else
+            {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+        }
+        std::lock_guard<std::mutex> lock(stateMutex);
+        queued--;
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(size_t index)
+{
+    currentPool = this;
+    currentWorker = index;
+    while (true)
+    {
+        std::function<void()> task;
+        if (takeTask(index, task))
+        {
+            task();
+            std::lock_guard<std::mutex> lock(stateMutex);
+            if (--pending == 0)
+                allDone.notify_all();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(stateMutex);
+        taskAvailable.wait(lock, [this]
+                           { return stopping || queued > 0; });
+        if (stopping && queued == 0)
+            return; // Stopping and nothing left to run
+    }
+}
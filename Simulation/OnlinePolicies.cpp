@@ -0,0 +1,253 @@
+#include "../Headers/Simulation.h"
+#include "../Headers/CylinderIndex.h"
+#include <algorithm>
+#include <cctype>
+
+namespace
+{
+    class FcfsPolicy : public OnlinePolicy
+    {
+    public:
+        const char *name() const override { return "FCFS"; }
+        void add(const PendingRequest &request) override { queue.push_back(request); }
+        size_t pending() const override { return queue.size(); }
+        SchedulerDecision next(int) override
+        {
+            SchedulerDecision decision;
+            if (queue.empty())
+                return decision;
+            decision.kind = SchedulerDecision::Service;
+            decision.request = queue.front();
+            queue.pop_front();
+            return decision;
+        }
+
+    private:
+        std::deque<PendingRequest> queue;
+    };
+
+    // Pending requests for the position-based policies: a CylinderIndex answers the
+    // nearest-cylinder queries, and each occupied cylinder keeps its requests in arrival
+    // order as a linked list of nodes in one slab with a free list. The list heads are a flat
+    // array indexed by cylinder, bounded by maxCylinder like the index itself.
+    class SortedPolicy : public OnlinePolicy
+    {
+    public:
+        explicit SortedPolicy(int maxCylinder)
+            : index(maxCylinder), fifos(static_cast<size_t>(std::max(0, maxCylinder)) + 1) {}
+
+        void add(const PendingRequest &request) override
+        {
+            int node;
+            if (freeNode >= 0)
+            {
+                node = freeNode;
+                freeNode = nodes[node].next;
+            }
+            else
+            {
+                node = static_cast<int>(nodes.size());
+                nodes.emplace_back();
+            }
+            nodes[node].request = request;
+            nodes[node].next = -1;
+
+            Fifo &fifo = fifos[request.cylinder];
+            if (fifo.tail < 0)
+                fifo.head = node;
+            else
+                nodes[fifo.tail].next = node;
+            fifo.tail = node;
+            index.insert(request.cylinder);
+        }
+        size_t pending() const override { return index.size(); }
+
+    protected:
+        // Serves the oldest request on an occupied cylinder
+        SchedulerDecision serve(int cylinder)
+        {
+            Fifo &fifo = fifos[cylinder];
+            int node = fifo.head;
+            fifo.head = nodes[node].next;
+            if (fifo.head < 0)
+                fifo.tail = -1;
+            index.remove(cylinder);
+
+            SchedulerDecision decision;
+            decision.kind = SchedulerDecision::Service;
+            decision.request = nodes[node].request;
+            nodes[node].next = freeNode;
+            freeNode = node;
+            return decision;
+        }
+        // The request serve(cylinder) would return
+        const PendingRequest &oldest(int cylinder) const { return nodes[fifos[cylinder].head].request; }
+        static SchedulerDecision moveTo(int cylinder)
+        {
+            SchedulerDecision decision;
+            decision.kind = SchedulerDecision::Move;
+            decision.cylinder = cylinder;
+            return decision;
+        }
+
+        CylinderIndex index;
+
+    private:
+        struct Node
+        {
+            PendingRequest request;
+            int next;
+        };
+        struct Fifo
+        {
+            int head = -1;
+            int tail = -1;
+        };
+        std::vector<Node> nodes;
+        int freeNode = -1;
+        std::vector<Fifo> fifos;
+    };
+
+    class SstfPolicy : public SortedPolicy
+    {
+    public:
+        using SortedPolicy::SortedPolicy;
+        const char *name() const override { return "SSTF"; }
+        SchedulerDecision next(int head) override
+        {
+            if (index.empty())
+                return SchedulerDecision();
+            int above = index.nextAtOrAbove(head);
+            int below = index.prevAtOrBelow(head);
+            if (above < 0)
+                return serve(below);
+            if (below < 0)
+                return serve(above);
+            if (above - head != head - below)
+                return serve(above - head < head - below ? above : below);
+            // Equal distances go to the older request, as in batch SSTF
+            const PendingRequest &up = oldest(above), &down = oldest(below);
+            bool upFirst = up.arrivalMs < down.arrivalMs || (up.arrivalMs == down.arrivalMs && up.id < down.id);
+            return serve(upFirst ? above : below);
+        }
+    };
+
+    // SCAN sweeps to the physical end of the disk before reversing; C-SCAN sweeps up to the
+    // end and returns to cylinder 0 without serving. Both only move when work is pending, and
+    // both start in the direction of their batch versions: SCAN down, C-SCAN up.
+    class ScanPolicy : public SortedPolicy
+    {
+    public:
+        ScanPolicy(int maxCylinder, bool circular)
+            : SortedPolicy(maxCylinder), maxCylinder(maxCylinder), circular(circular), movingUp(circular) {}
+        const char *name() const override { return circular ? "C-SCAN" : "SCAN"; }
+        SchedulerDecision next(int head) override
+        {
+            if (index.empty())
+                return SchedulerDecision();
+            if (movingUp)
+            {
+                int above = index.nextAtOrAbove(head);
+                if (above >= 0)
+                    return serve(above);
+                if (head < maxCylinder)
+                    return moveTo(maxCylinder);
+                if (circular)
+                    return moveTo(0);
+                movingUp = false;
+            }
+            int below = index.prevAtOrBelow(head);
+            if (below >= 0)
+                return serve(below);
+            if (head > 0)
+                return moveTo(0);
+            movingUp = true;
+            return serve(index.nextAtOrAbove(head));
+        }
+
+    private:
+        int maxCylinder;
+        bool circular;
+        bool movingUp;
+    };
+
+    // LOOK reverses at the last pending request; C-LOOK jumps back to the lowest one
+    class LookPolicy : public SortedPolicy
+    {
+    public:
+        LookPolicy(int maxCylinder, bool circular) : SortedPolicy(maxCylinder), circular(circular) {}
+        const char *name() const override { return circular ? "C-LOOK" : "LOOK"; }
+        SchedulerDecision next(int head) override
+        {
+            if (index.empty())
+                return SchedulerDecision();
+            if (circular)
+            {
+                int above = index.nextAtOrAbove(head);
+                return serve(above >= 0 ? above : index.first());
+            }
+            int target = movingUp ? index.nextAtOrAbove(head) : index.prevAtOrBelow(head);
+            if (target < 0)
+            {
+                movingUp = !movingUp;
+                target = movingUp ? index.nextAtOrAbove(head) : index.prevAtOrBelow(head);
+            }
+            return serve(target);
+        }
+
+    private:
+        bool circular;
+        bool movingUp = true;
+    };
+
+    // Online HDSA: at every decision, take the first step of batch HDSA on the current
+    // pending set, i.e. head towards the side whose farthest request is closer so the short
+    // side is cleared first. New arrivals can change that choice mid-sweep.
+    class HdsaPolicy : public SortedPolicy
+    {
+    public:
+        using SortedPolicy::SortedPolicy;
+        const char *name() const override { return "HDSA"; }
+        SchedulerDecision next(int head) override
+        {
+            if (index.empty())
+                return SchedulerDecision();
+            if (index.contains(head))
+                return serve(head);
+
+            int lowest = index.first();
+            int highest = index.last();
+            int x = lowest < head ? head - lowest : std::numeric_limits<int>::max();
+            int y = highest > head ? highest - head : std::numeric_limits<int>::max();
+            return serve(x > y ? index.nextAtOrAbove(head) : index.prevAtOrBelow(head));
+        }
+    };
+}
+
+const std::vector<std::string> &onlinePolicyNames()
+{
+    static const std::vector<std::string> names = {"FCFS", "SSTF", "SCAN", "C-SCAN", "LOOK", "C-LOOK", "HDSA"};
+    return names;
+}
+
+std::unique_ptr<OnlinePolicy> makeOnlinePolicy(const std::string &name, int maxCylinder)
+{
+    std::string key = name;
+    std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c)
+                   { return static_cast<char>(std::toupper(c)); });
+    if (key == "FCFS")
+        return std::unique_ptr<OnlinePolicy>(new FcfsPolicy());
+    if (key == "SSTF")
+        return std::unique_ptr<OnlinePolicy>(new SstfPolicy(maxCylinder));
+    if (key == "SCAN")
+        return std::unique_ptr<OnlinePolicy>(new ScanPolicy(maxCylinder, false));
+    if (key == "C-SCAN" || key == "CSCAN")
+        return std::unique_ptr<OnlinePolicy>(new ScanPolicy(maxCylinder, true));
+    if (key == "LOOK")
+        return std::unique_ptr<OnlinePolicy>(new LookPolicy(maxCylinder, false));
+    if (key == "C-LOOK" || key == "CLOOK")
+        return std::unique_ptr<OnlinePolicy>(new LookPolicy(maxCylinder, true));
+    if (key == "HDSA")
+        return std::unique_ptr<OnlinePolicy>(new HdsaPolicy(maxCylinder));
+    return nullptr;
+}
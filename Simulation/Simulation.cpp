@@ -0,0 +1,418 @@
+#include "../Headers/Simulation.h"
+#include "../Headers/QueueGeneration.h"
+#include "../Headers/Batch.h"
+#include <random>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+#include <cctype>
+
+const char *arrivalProcessName(ArrivalProcess process)
+{
+    return process == ArrivalProcess::Bursty ? "bursty" : "poisson";
+}
+
+bool parseArrivalProcessName(const std::string &name, ArrivalProcess &process)
+{
+    std::string key = name;
+    std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c)
+                   { return static_cast<char>(std::tolower(c)); });
+    if (key == "poisson")
+        process = ArrivalProcess::Poisson;
+    else if (key == "bursty")
+        process = ArrivalProcess::Bursty;
+    else
+        return false;
+    return true;
+}
+
+// --- Event list ---
+
+static bool laterThan(const EventQueue::Event &a, const EventQueue::Event &b)
+{
+    return a.timeMs != b.timeMs ? a.timeMs > b.timeMs : a.sequence > b.sequence;
+}
+
+void EventQueue::push(double timeMs, Kind kind)
+{
+    heap.push_back({timeMs, nextSequence++, kind});
+    std::push_heap(heap.begin(), heap.end(), laterThan);
+}
+
+EventQueue::Event EventQueue::pop()
+{
+    std::pop_heap(heap.begin(), heap.end(), laterThan);
+    Event event = heap.back();
+    heap.pop_back();
+    return event;
+}
+
+// --- Arrivals ---
+
+namespace
+{
+    // Inter-arrival times for either process. Bursty is a two-state modulated Poisson
+    // process: bursts of mean length burstMeanMs at rate * burstFactor, separated by silent
+    // gaps sized so the long-run rate is still `rate`.
+    class ArrivalStream
+    {
+    public:
+        ArrivalStream(const SimulationConfig &config, uint64_t seed)
+            : rng(seed), process(config.arrivals),
+              ratePerMs(config.arrivalRatePerSec / 1000.0),
+              burstFactor(std::max(1.0, config.burstFactor)),
+              burstMeanMs(std::max(1e-9, config.burstMeanMs))
+        {
+            if (process == ArrivalProcess::Bursty)
+                burstLeftMs = exponential(1.0 / burstMeanMs);
+        }
+
+        double next(double nowMs)
+        {
+            if (process == ArrivalProcess::Poisson || burstFactor <= 1.0)
+                return nowMs + exponential(ratePerMs);
+            double burstRate = ratePerMs * burstFactor;
+            double gapMeanMs = burstMeanMs * (burstFactor - 1.0);
+            while (true)
+            {
+                double gap = exponential(burstRate);
+                if (gap < burstLeftMs)
+                {
+                    burstLeftMs -= gap;
+                    return nowMs + gap;
+                }
+                // Burst ended before the next arrival: skip the silence, start a new burst
+                nowMs += burstLeftMs + exponential(1.0 / gapMeanMs);
+                burstLeftMs = exponential(1.0 / burstMeanMs);
+            }
+        }
+
+    private:
+        double exponential(double rate)
+        {
+            return std::exponential_distribution<double>(rate)(rng);
+        }
+
+        std::mt19937_64 rng;
+        ArrivalProcess process;
+        double ratePerMs;
+        double burstFactor;
+        double burstMeanMs;
+        double burstLeftMs = 0.0;
+    };
+}
+
+// --- Simulation core ---
+
+SimulationResult simulate(const SimulationConfig &config, OnlinePolicy &policy)
+{
+    SimulationResult result;
+    result.policy = policy.name();
+    result.offeredRatePerSec = config.arrivalRatePerSec;
+    if (config.numRequests <= 0 || config.arrivalRatePerSec <= 0.0)
+        return result;
+
+    // Separate streams for timing and placement, both fixed by the seed alone
+    ArrivalStream arrivals(config, deriveSeed(config.seed, 0));
+    std::mt19937_64 cylinderRng(deriveSeed(config.seed, 1));
+    std::uniform_int_distribution<int> cylinderDist(0, std::max(0, config.maxCylinder));
+    const DiskPerformanceParams &params = config.diskParams;
+
+    EventQueue events;
+    long long arrived = 0;
+    events.push(arrivals.next(0.0), EventQueue::Arrival);
+
+    int head = config.startHead;
+    bool busy = false;
+    bool inServiceIsRequest = false;
+    PendingRequest inService;
+    double busyMs = 0.0;
+    double queueAreaMs = 0.0;
+    double lastEventMs = 0.0;
+    double responseSumMs = 0.0;
+    long long measured = 0;
+
+    // Start whatever the policy wants next; the disk is free at `nowMs`
+    auto dispatch = [&](double nowMs)
+    {
+        SchedulerDecision decision = policy.next(head);
+        if (decision.kind == SchedulerDecision::Idle)
+            return;
+        int target = decision.kind == SchedulerDecision::Service ? decision.request.cylinder : decision.cylinder;
+        int distance = std::abs(target - head);
+        double durationMs = params.seekTimeMs(distance);
+        if (decision.kind == SchedulerDecision::Service)
+            durationMs += params.avgRotationalLatencyMs + params.transferTimeMs(decision.request.sizeKB);
+        result.totalMovement += distance;
+        head = target;
+        busy = true;
+        busyMs += durationMs;
+        inServiceIsRequest = decision.kind == SchedulerDecision::Service;
+        inService = decision.request;
+        events.push(nowMs + durationMs, EventQueue::Completion);
+    };
+
+    while (!events.empty())
+    {
+        EventQueue::Event event = events.pop();
+        double nowMs = event.timeMs;
+        queueAreaMs += policy.pending() * (nowMs - lastEventMs);
+        lastEventMs = nowMs;
+        result.events++;
+
+        if (event.kind == EventQueue::Arrival)
+        {
+            PendingRequest request;
+            request.id = arrived++;
+            request.cylinder = cylinderDist(cylinderRng);
+            request.arrivalMs = nowMs;
+            request.sizeKB = config.requestSizeKB;
+            policy.add(request);
+            result.maxQueueLength = std::max(result.maxQueueLength, policy.pending());
+            if (arrived < config.numRequests)
+                events.push(arrivals.next(nowMs), EventQueue::Arrival);
+            if (!busy)
+                dispatch(nowMs);
+        }
+        else
+        {
+            busy = false;
+            if (inServiceIsRequest)
+            {
+                result.completed++;
+                if (result.completed > config.warmupRequests)
+                {
+                    double responseMs = nowMs - inService.arrivalMs;
+                    responseSumMs += responseMs;
+                    result.maxResponseMs = std::max(result.maxResponseMs, responseMs);
+                    result.responseHistogram.record(static_cast<unsigned long long>(std::llround(responseMs * 1000.0)));
+                    measured++;
+                }
+            }
+            dispatch(nowMs);
+        }
+    }
+
+    result.simulatedMs = lastEventMs;
+    if (result.simulatedMs > 0.0)
+    {
+        result.throughputPerSec = result.completed / result.simulatedMs * 1000.0;
+        result.utilization = std::min(1.0, busyMs / result.simulatedMs);
+        result.meanQueueLength = queueAreaMs / result.simulatedMs;
+    }
+    if (measured > 0)
+        result.meanResponseMs = responseSumMs / measured;
+    result.responsePercentiles = summarizeHistogram(result.responseHistogram, 0.001);
+    result.saturated = result.throughputPerSec < 0.95 * config.arrivalRatePerSec;
+    return result;
+}
+
+std::vector<SimulationResult> sweepArrivalRates(const SimulationConfig &config,
+                                                const std::vector<std::string> &policies,
+                                                const std::vector<double> &ratesPerSec,
+                                                ThreadPool &pool)
+{
+    std::vector<SimulationResult> results(policies.size() * ratesPerSec.size());
+    for (size_t p = 0; p < policies.size(); ++p)
+    {
+        for (size_t r = 0; r < ratesPerSec.size(); ++r)
+        {
+            // Each task owns its policy and writes only its own slot
+            pool.submit([&, p, r]
+                        {
+                            SimulationConfig runConfig = config;
+                            runConfig.arrivalRatePerSec = ratesPerSec[r];
+                            std::unique_ptr<OnlinePolicy> policy = makeOnlinePolicy(policies[p], config.maxCylinder);
+                            results[p * ratesPerSec.size() + r] = simulate(runConfig, *policy); });
+        }
+    }
+    pool.wait();
+    return results;
+}
+
+double saturationRate(const std::vector<SimulationResult> &results, const std::string &policy)
+{
+    double best = 0.0;
+    for (const SimulationResult &result : results)
+    {
+        if (result.policy == policy && !result.saturated)
+            best = std::max(best, result.offeredRatePerSec);
+    }
+    return best;
+}
+
+// --- Command line ---
+
+void printSimulationUsage(std::ostream &out)
+{
+    out << "Usage: main --simulate [options]\n"
+        << "Lists are comma-separated (a,b,c) or inclusive ranges (start:end:step).\n"
+        << "  --policies LIST        fcfs, sstf, scan, c-scan, look, c-look, hdsa (default all)\n"
+        << "  --rates LIST           Mean arrival rates in requests/s (default 50:300:50)\n"
+        << "  --arrivals NAME        poisson or bursty (default poisson)\n"
+        << "  --burst-factor X       Bursty: rate inside a burst relative to the mean (default 4)\n"
+        << "  --burst-ms X           Bursty: mean burst length in ms (default 50)\n"
+        << "  --requests N           Requests per run (default 100000)\n"
+        << "  --warmup N             Completions excluded from response times (default 0)\n"
+        << "  --head N               Start head position (default 50)\n"
+        << "  --cylinders N          Max cylinder number (default 199)\n"
+        << "  --seek-ms X            Seek time per cylinder in ms (default 0.1)\n"
+        << "  --seek-curve S,A,B,K   Seek time settle + A*sqrt(d) up to K cylinders, then linear at B ms/cyl\n"
+        << "  --seek-profile FILE    Measured seek times, 'distance time_ms' per line\n"
+        << "  --rpm X                Rotational speed (default 7200)\n"
+        << "  --transfer-mbps X      Transfer rate in MB/s (default 100)\n"
+        << "  --request-kb X         Request size in KB (default 4)\n"
+        << "  --seed N               Seed of the arrival stream (default 1)\n"
+        << "  --threads N            Worker threads, 0 = all cores (default 0)\n"
+        << "  --output FILE          CSV output path (default stdout)\n";
+}
+
+int simulateMain(int argc, char *argv[])
+{
+    SimulationConfig config;
+    std::vector<std::string> policies = onlinePolicyNames();
+    std::vector<double> rates = {50, 100, 150, 200, 250, 300};
+    double seekMs = 0.1, rpm = 7200.0, transferMBps = 100.0;
+    size_t numThreads = 0;
+    std::string outputPath, seekCurveSpec, seekProfilePath;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--simulate")
+            continue;
+        if (arg == "--help")
+        {
+            printSimulationUsage(std::cout);
+            return 0;
+        }
+        if (arg.rfind("--", 0) != 0 || i + 1 >= argc)
+        {
+            std::cerr << "Error: expected '--option value', got '" << arg << "'" << std::endl;
+            printSimulationUsage(std::cerr);
+            return 1;
+        }
+        std::string key = arg.substr(2), value = argv[++i], error;
+        bool ok = true;
+        if (key == "policies")
+        {
+            policies.clear();
+            std::stringstream ss(value);
+            std::string name;
+            while (std::getline(ss, name, ','))
+            {
+                std::unique_ptr<OnlinePolicy> policy = makeOnlinePolicy(name, 0);
+                if (!policy)
+                {
+                    error = "unknown policy '" + name + "'";
+                    ok = false;
+                    break;
+                }
+                policies.push_back(policy->name());
+            }
+            ok = ok && !policies.empty();
+        }
+        else if (key == "rates")
+            ok = parseNumberList(value, rates, error);
+        else if (key == "arrivals")
+            ok = parseArrivalProcessName(value, config.arrivals);
+        else if (key == "burst-factor")
+            config.burstFactor = std::atof(value.c_str());
+        else if (key == "burst-ms")
+            config.burstMeanMs = std::atof(value.c_str());
+        else if (key == "requests")
+            config.numRequests = std::atoll(value.c_str());
+        else if (key == "warmup")
+            config.warmupRequests = std::atoll(value.c_str());
+        else if (key == "head")
+            config.startHead = std::atoi(value.c_str());
+        else if (key == "cylinders")
+            config.maxCylinder = std::atoi(value.c_str());
+        else if (key == "seek-ms")
+            seekMs = std::atof(value.c_str());
+        else if (key == "seek-curve")
+            seekCurveSpec = value;
+        else if (key == "seek-profile")
+            seekProfilePath = value;
+        else if (key == "rpm")
+            rpm = std::atof(value.c_str());
+        else if (key == "transfer-mbps")
+            transferMBps = std::atof(value.c_str());
+        else if (key == "request-kb")
+            config.requestSizeKB = std::atof(value.c_str());
+        else if (key == "seed")
+            config.seed = std::strtoull(value.c_str(), nullptr, 10);
+        else if (key == "threads")
+            numThreads = std::strtoul(value.c_str(), nullptr, 10);
+        else if (key == "output")
+            outputPath = value;
+        else
+        {
+            error = "unknown option '" + key + "'";
+            ok = false;
+        }
+        if (!ok)
+        {
+            std::cerr << "Error: " << (error.empty() ? "invalid value for '" + key + "'" : error) << std::endl;
+            printSimulationUsage(std::cerr);
+            return 1;
+        }
+    }
+    if (config.maxCylinder < 0 || config.startHead < 0 || config.startHead > config.maxCylinder ||
+        rpm <= 0.0 || transferMBps <= 0.0 || config.requestSizeKB <= 0.0)
+    {
+        std::cerr << "Error: invalid disk configuration." << std::endl;
+        return 1;
+    }
+    config.diskParams = deriveDiskParams(seekMs, rpm, transferMBps, config.requestSizeKB);
+    if (!seekProfilePath.empty() || !seekCurveSpec.empty())
+    {
+        std::string error;
+        config.diskParams.seekCurve = !seekProfilePath.empty() ? loadSeekProfile(seekProfilePath, config.maxCylinder, error)
+                                                               : parseSeekCurveSpec(seekCurveSpec, config.maxCylinder, error);
+        if (!config.diskParams.seekCurve)
+        {
+            std::cerr << "Error: " << error << std::endl;
+            return 1;
+        }
+    }
+
+    ThreadPool pool(numThreads);
+    auto wallBegin = std::chrono::steady_clock::now();
+    std::vector<SimulationResult> results = sweepArrivalRates(config, policies, rates, pool);
+    double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wallBegin).count();
+
+    std::ofstream file;
+    if (!outputPath.empty())
+    {
+        file.open(outputPath);
+        if (!file)
+        {
+            std::cerr << "Error: cannot write '" << outputPath << "'." << std::endl;
+            return 1;
+        }
+    }
+    std::ostream &out = outputPath.empty() ? std::cout : file;
+    out << "policy,arrivals,offered_rate_per_s,completed,simulated_ms,throughput_per_s,utilization,total_movement,"
+           "mean_response_ms,p50_response_ms,p90_response_ms,p99_response_ms,p999_response_ms,max_response_ms,"
+           "mean_queue_length,max_queue_length,events,saturated\n";
+    out << std::setprecision(10);
+    long long totalEvents = 0;
+    for (const SimulationResult &r : results)
+    {
+        out << r.policy << "," << arrivalProcessName(config.arrivals) << "," << r.offeredRatePerSec << ","
+            << r.completed << "," << r.simulatedMs << "," << r.throughputPerSec << "," << r.utilization << ","
+            << r.totalMovement << "," << r.meanResponseMs << "," << r.responsePercentiles.p50 << ","
+            << r.responsePercentiles.p90 << "," << r.responsePercentiles.p99 << "," << r.responsePercentiles.p999 << ","
+            << r.maxResponseMs << "," << r.meanQueueLength << "," << r.maxQueueLength << "," << r.events << ","
+            << (r.saturated ? 1 : 0) << "\n";
+        totalEvents += r.events;
+    }
+
+    for (const std::string &policy : policies)
+        std::cerr << policy << ": keeps up with " << saturationRate(results, policy) << " req/s of the swept rates." << std::endl;
+    std::cerr << "Simulate: " << results.size() << " runs, " << totalEvents << " events in " << std::fixed
+              << std::setprecision(1) << wallMs << " ms on " << pool.size() << " threads." << std::endl;
+    return 0;
+}
@@ -0,0 +1,571 @@
+#include "../Headers/TraceIO.h"
+#include "../Headers/QueueParser.h"
+#include "../Headers/QueueGeneration.h"
+#include "../Headers/Runner.h"
+#include <cstring>
+#include <cerrno>
+#include <chrono>
+#include <algorithm>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static const char traceMagic[4] = {'D', 'T', 'R', 'C'};
+static const uint16_t traceVersion = 1;
+static const size_t headerBytes = 32;
+static const size_t writeBufferBytes = 1 << 20;
+
+// Fixed little-endian fields, independent of the host byte order
+static void putLE(uint8_t *p, uint64_t value, int bytes)
+{
+    for (int i = 0; i < bytes; ++i)
+        p[i] = static_cast<uint8_t>(value >> (8 * i));
+}
+
+static uint64_t getLE(const uint8_t *p, int bytes)
+{
+    uint64_t value = 0;
+    for (int i = 0; i < bytes; ++i)
+        value |= static_cast<uint64_t>(p[i]) << (8 * i);
+    return value;
+}
+
+static void encodeHeader(const TraceHeader &header, uint8_t *p)
+{
+    std::memcpy(p, traceMagic, 4);
+    putLE(p + 4, traceVersion, 2);
+    p[6] = static_cast<uint8_t>(header.kind);
+    p[7] = static_cast<uint8_t>(header.elementWidth);
+    putLE(p + 8, static_cast<uint32_t>(header.maxCylinder), 4);
+    putLE(p + 12, static_cast<uint32_t>(header.startHead), 4);
+    putLE(p + 16, header.count, 8);
+    putLE(p + 24, header.payloadBytes, 8);
+}
+
+static bool decodeHeader(const uint8_t *p, size_t bytes, TraceHeader &header, std::string &error)
+{
+    if (bytes < 4 || std::memcmp(p, traceMagic, 4) != 0)
+    {
+        error = "not a trace file";
+        return false;
+    }
+    if (bytes < headerBytes)
+    {
+        error = "truncated trace header";
+        return false;
+    }
+    if (getLE(p + 4, 2) != traceVersion)
+    {
+        error = "unsupported trace version " + std::to_string(getLE(p + 4, 2));
+        return false;
+    }
+    if (p[6] > static_cast<uint8_t>(TraceKind::SeekSequence))
+    {
+        error = "unknown trace kind " + std::to_string(p[6]);
+        return false;
+    }
+    // Values decode into int, so a wider element could only come from another writer
+    if (p[7] != 1 && p[7] != 2 && p[7] != 4)
+    {
+        error = "unsupported trace element width " + std::to_string(p[7]);
+        return false;
+    }
+    header.kind = static_cast<TraceKind>(p[6]);
+    header.elementWidth = p[7];
+    header.maxCylinder = static_cast<int32_t>(getLE(p + 8, 4));
+    header.startHead = static_cast<int32_t>(getLE(p + 12, 4));
+    header.count = getLE(p + 16, 8);
+    header.payloadBytes = getLE(p + 24, 8);
+    // Every value takes at least one byte, which also bounds what readAll() reserves
+    if (header.payloadBytes > bytes - headerBytes || header.count > header.payloadBytes)
+    {
+        error = "truncated trace (header promises " + std::to_string(header.count) + " values in " +
+                std::to_string(header.payloadBytes) + " bytes)";
+        return false;
+    }
+    return true;
+}
+
+static int elementWidthFor(int maxCylinder)
+{
+    if (maxCylinder < (1 << 8))
+        return 1;
+    if (maxCylinder < (1 << 16))
+        return 2;
+    return 4;
+}
+
+TraceWriter::~TraceWriter()
+{
+    std::string ignored;
+    close(ignored);
+}
+
+bool TraceWriter::open(const std::string &path, TraceKind kind, int maxCylinder, int startHead, std::string &error)
+{
+    std::string ignored;
+    close(ignored);
+    file = std::fopen(path.c_str(), "wb");
+    if (!file)
+    {
+        error = "cannot write '" + path + "': " + std::strerror(errno);
+        return false;
+    }
+    header = TraceHeader();
+    header.kind = kind;
+    header.elementWidth = elementWidthFor(maxCylinder);
+    header.maxCylinder = maxCylinder;
+    header.startHead = startHead;
+    previous = startHead;
+    writeFailed = false;
+    buffer.clear();
+    buffer.reserve(writeBufferBytes + 16);
+    buffer.resize(headerBytes); // Placeholder, rewritten by close()
+    return true;
+}
+
+void TraceWriter::push(int cylinder)
+{
+    int64_t delta = static_cast<int64_t>(cylinder) - previous;
+    uint64_t zigzag = (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63);
+    size_t before = buffer.size();
+    while (zigzag >= 0x80)
+    {
+        buffer.push_back(static_cast<uint8_t>(zigzag | 0x80));
+        zigzag >>= 7;
+    }
+    buffer.push_back(static_cast<uint8_t>(zigzag));
+    header.payloadBytes += buffer.size() - before;
+    header.count++;
+    previous = cylinder;
+    if (buffer.size() >= writeBufferBytes)
+        flush();
+}
+
+void TraceWriter::flush()
+{
+    if (!buffer.empty() && std::fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size())
+        writeFailed = true;
+    buffer.clear();
+}
+
+bool TraceWriter::close(std::string &error)
+{
+    if (!file)
+        return true;
+    flush();
+    uint8_t encoded[headerBytes];
+    encodeHeader(header, encoded);
+    if (std::fseek(file, 0, SEEK_SET) != 0 || std::fwrite(encoded, 1, headerBytes, file) != headerBytes)
+        writeFailed = true;
+    if (std::fclose(file) != 0)
+        writeFailed = true;
+    file = nullptr;
+    if (writeFailed)
+        error = "error writing trace file";
+    return !writeFailed;
+}
+
+TraceReader::~TraceReader()
+{
+    release();
+}
+
+void TraceReader::release()
+{
+#ifndef _WIN32
+    if (mapped)
+        munmap(const_cast<uint8_t *>(mapped), mappedBytes);
+#endif
+    mapped = nullptr;
+    mappedBytes = 0;
+    fallback.clear();
+    fallback.shrink_to_fit();
+}
+
+bool TraceReader::open(const std::string &path, std::string &error)
+{
+    release();
+    errorMessage.clear();
+    decoded = 0;
+    const uint8_t *data = nullptr;
+    size_t bytes = 0;
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        error = "cannot open '" + path + "': " + std::strerror(errno);
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        error = "cannot stat '" + path + "': " + std::strerror(errno);
+        ::close(fd);
+        return false;
+    }
+    bytes = static_cast<size_t>(info.st_size);
+    if (bytes > 0)
+    {
+        void *view = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view == MAP_FAILED)
+        {
+            error = "cannot map '" + path + "': " + std::strerror(errno);
+            ::close(fd);
+            return false;
+        }
+        madvise(view, bytes, MADV_SEQUENTIAL);
+        mapped = static_cast<const uint8_t *>(view);
+        mappedBytes = bytes;
+        data = mapped;
+    }
+    ::close(fd); // The mapping stays valid
+#else
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    if (!file)
+    {
+        error = "cannot open '" + path + "': " + std::strerror(errno);
+        return false;
+    }
+    std::fseek(file, 0, SEEK_END);
+    long length = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+    fallback.resize(length > 0 ? static_cast<size_t>(length) : 0);
+    bytes = std::fread(fallback.data(), 1, fallback.size(), file);
+    std::fclose(file);
+    data = fallback.data();
+#endif
+    if (!decodeHeader(data, bytes, fileHeader, error))
+    {
+        error = path + ": " + error;
+        release();
+        return false;
+    }
+    cursor = data + headerBytes;
+    end = cursor + fileHeader.payloadBytes;
+    previous = fileHeader.startHead;
+    return true;
+}
+
+size_t TraceReader::read(int *out, size_t maxValues)
+{
+    size_t n = std::min<uint64_t>(maxValues, remaining());
+    const uint8_t *p = cursor;
+    int64_t value = previous;
+    size_t i = 0;
+    auto corrupt = [&]() -> size_t
+    {
+        errorMessage = "corrupt trace payload at value " + std::to_string(decoded + i);
+        cursor = p;
+        decoded += i;
+        previous = static_cast<int>(value);
+        return 0;
+    };
+    // Away from the end a varint (at most 10 bytes) cannot run past the payload, so the
+    // hot loop needs no bounds checks
+    while (i < n && end - p >= 10)
+    {
+        uint64_t zigzag = *p++;
+        if (zigzag >= 0x80)
+        {
+            zigzag &= 0x7F;
+            int shift = 7;
+            uint8_t byte;
+            do
+            {
+                byte = *p++;
+                zigzag |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                shift += 7;
+            } while (byte >= 0x80 && shift < 70);
+            if (byte >= 0x80)
+                return corrupt(); // Still continuing after 10 bytes, as the tail loop reports
+        }
+        value += static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+        out[i++] = static_cast<int>(value);
+    }
+    for (; i < n; ++i)
+    {
+        uint64_t zigzag = 0;
+        int shift = 0;
+        while (true)
+        {
+            if (p == end || shift > 63)
+                return corrupt();
+            uint8_t byte = *p++;
+            zigzag |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (byte < 0x80)
+                break;
+            shift += 7;
+        }
+        value += static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+        out[i] = static_cast<int>(value);
+    }
+    cursor = p;
+    decoded += n;
+    previous = static_cast<int>(value);
+    return n;
+}
+
+bool TraceReader::readAll(std::vector<int> &values, std::string &error)
+{
+    size_t start = values.size();
+    values.resize(start + remaining());
+    size_t got = read(values.data() + start, values.size() - start);
+    values.resize(start + got);
+    if (failed())
+    {
+        error = errorMessage;
+        return false;
+    }
+    return true;
+}
+
+bool writeQueueTrace(const std::string &path, const std::vector<int> &queue, int maxCylinder, int startHead, std::string &error)
+{
+    TraceWriter writer;
+    if (!writer.open(path, TraceKind::Queue, maxCylinder, startHead, error))
+        return false;
+    for (int cylinder : queue)
+        writer.push(cylinder);
+    return writer.close(error);
+}
+
+bool writeSeekSequenceTrace(const std::string &path, const AlgorithmResult &result, int maxCylinder, std::string &error)
+{
+    if (result.seekSequence.empty())
+    {
+        error = result.name + " has no stored seek sequence";
+        return false;
+    }
+    TraceWriter writer;
+    if (!writer.open(path, TraceKind::SeekSequence, maxCylinder, result.seekSequence.front(), error))
+        return false;
+    for (int cylinder : result.seekSequence)
+        writer.push(cylinder);
+    return writer.close(error);
+}
+
+bool isTraceFile(const std::string &path)
+{
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+    char magic[4];
+    bool match = std::fread(magic, 1, 4, file) == 4 && std::memcmp(magic, traceMagic, 4) == 0;
+    std::fclose(file);
+    return match;
+}
+
+bool loadQueueFile(const std::string &path, std::vector<int> &queue, std::string &error, std::ostream &warnings)
+{
+    queue.clear();
+    if (path != "-" && isTraceFile(path))
+    {
+        TraceReader reader;
+        return reader.open(path, error) && reader.readAll(queue, error);
+    }
+    QueueParseResult parsed;
+    if (!parseQueueFile(path, parsed, error))
+        return false;
+    reportQueueParseIssues(parsed, warnings);
+    queue.swap(parsed.values);
+    return true;
+}
+
+void printTraceUsage(std::ostream &out)
+{
+    out << "Usage: main --trace [options]\n"
+        << "Writes a binary trace of a queue, or of one algorithm's seek sequence.\n"
+        << "  --input FILE           Queue to convert, text or binary (default: generate one)\n"
+        << "  --pattern NAME         Generated queue: uniform, sequential, clustered, mixed, zipf, hotcold,\n"
+        << "                         locality (default uniform; skewed patterns use default parameters)\n"
+        << "  --size N               Generated queue length (default 100)\n"
+        << "  --clusters N           Clusters for the clustered pattern (default 5)\n"
+        << "  --seed N               Generator seed (default 1); the queue does not depend on --threads\n"
+        << "  --threads N            Generator threads, 0 = all cores (default 0)\n"
+        << "  --cylinders N          Max cylinder number (default 199, or the input trace's)\n"
+        << "  --head N               Start head position (default 50, or the input trace's)\n"
+        << "  --algorithm NAME       Write this algorithm's seek sequence instead of the queue\n"
+        << "  --output FILE          Trace file to write\n"
+        << "  --dump FILE            Print a trace's header and values instead\n";
+}
+
+// Header to stderr, values to stdout, decoded in blocks so the whole trace is never held
+static int dumpTrace(const std::string &path)
+{
+    TraceReader reader;
+    std::string error;
+    if (!reader.open(path, error))
+    {
+        std::cerr << "Error: " << error << std::endl;
+        return 1;
+    }
+    const TraceHeader &h = reader.header();
+    std::cerr << (h.kind == TraceKind::Queue ? "queue" : "seek sequence") << ", " << h.count << " values, max cylinder "
+              << h.maxCylinder << ", start head " << h.startHead << ", " << h.payloadBytes << " payload bytes" << std::endl;
+    std::vector<int> block(1 << 16);
+    bool first = true;
+    while (size_t n = reader.read(block.data(), block.size()))
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            std::cout << (first ? "" : ",") << block[i];
+            first = false;
+        }
+    }
+    std::cout << "\n";
+    if (reader.failed())
+    {
+        std::cerr << "Error: " << reader.error() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+int traceMain(int argc, char *argv[])
+{
+    std::string inputPath, outputPath, algorithm;
+    QueuePattern pattern = QueuePattern::Uniform;
+    long long size = 100;
+    int clusters = 5, maxCylinder = -1, startHead = -1;
+    uint64_t seed = 1;
+    size_t numThreads = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--trace")
+            continue;
+        if (arg == "--help")
+        {
+            printTraceUsage(std::cout);
+            return 0;
+        }
+        if (arg.rfind("--", 0) != 0 || i + 1 >= argc)
+        {
+            std::cerr << "Error: expected '--option value', got '" << arg << "'" << std::endl;
+            printTraceUsage(std::cerr);
+            return 1;
+        }
+        std::string key = arg.substr(2), value = argv[++i];
+        bool ok = true;
+        if (key == "dump")
+            return dumpTrace(value);
+        else if (key == "input")
+            inputPath = value;
+        else if (key == "output")
+            outputPath = value;
+        else if (key == "algorithm")
+            algorithm = value;
+        else if (key == "pattern")
+            ok = parsePatternName(value, pattern);
+        else if (key == "size")
+            size = std::atoll(value.c_str());
+        else if (key == "clusters")
+            clusters = std::max(1, std::atoi(value.c_str()));
+        else if (key == "seed")
+            seed = std::strtoull(value.c_str(), nullptr, 10);
+        else if (key == "cylinders")
+            maxCylinder = std::atoi(value.c_str());
+        else if (key == "head")
+            startHead = std::atoi(value.c_str());
+        else if (key == "threads")
+            numThreads = std::strtoul(value.c_str(), nullptr, 10);
+        else
+            ok = false;
+        if (!ok)
+        {
+            std::cerr << "Error: invalid option '--" << key << " " << value << "'" << std::endl;
+            printTraceUsage(std::cerr);
+            return 1;
+        }
+    }
+    if (outputPath.empty())
+    {
+        std::cerr << "Error: --output is required." << std::endl;
+        printTraceUsage(std::cerr);
+        return 1;
+    }
+
+    std::vector<int> queue;
+    std::string error;
+    auto loadStart = std::chrono::steady_clock::now();
+    if (!inputPath.empty())
+    {
+        if (inputPath != "-" && isTraceFile(inputPath))
+        {
+            TraceReader reader;
+            if (!reader.open(inputPath, error) || !reader.readAll(queue, error))
+            {
+                std::cerr << "Error: " << error << std::endl;
+                return 1;
+            }
+            if (maxCylinder < 0)
+                maxCylinder = reader.header().maxCylinder;
+            if (startHead < 0)
+                startHead = reader.header().startHead;
+        }
+        else if (!loadQueueFile(inputPath, queue, error))
+        {
+            std::cerr << "Error: " << error << std::endl;
+            return 1;
+        }
+    }
+    maxCylinder = maxCylinder < 0 ? 199 : maxCylinder;
+    startHead = startHead < 0 ? 50 : startHead;
+    if (inputPath.empty())
+    {
+        ThreadPool pool(numThreads);
+        queue = generatePatternParallel(pattern, maxCylinder, std::max(1ll, size), clusters, seed, &pool);
+    }
+    double loadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadStart).count();
+    if (queue.empty())
+    {
+        std::cerr << "Error: the queue is empty." << std::endl;
+        return 1;
+    }
+    if (startHead > maxCylinder || *std::min_element(queue.begin(), queue.end()) < 0 ||
+        *std::max_element(queue.begin(), queue.end()) > maxCylinder)
+    {
+        std::cerr << "Error: head or requests outside 0.." << maxCylinder << "." << std::endl;
+        return 1;
+    }
+    std::cerr << "Loaded " << queue.size() << " requests in " << loadMs << " ms." << std::endl;
+
+    if (algorithm.empty())
+    {
+        if (!writeQueueTrace(outputPath, queue, maxCylinder, startHead, error))
+        {
+            std::cerr << "Error: " << error << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    // Default disk parameters: only the order of the sequence matters here
+    std::string wanted = algorithm;
+    std::transform(wanted.begin(), wanted.end(), wanted.begin(), [](unsigned char c)
+                   { return static_cast<char>(std::toupper(c)); });
+    DiskPerformanceParams diskParams = deriveDiskParams(0.1, 7200.0, 100.0, 4.0);
+    PreparedQueue prepared = prepareQueue(startHead, queue);
+    std::vector<Request> requests = makeRequests(queue, 4.0);
+    MetricsOptions options;
+    options.storeSequence = true;
+    for (const AlgorithmJob &job : standardAlgorithmJobs(startHead, maxCylinder, queue, prepared, diskParams, &requests, options))
+    {
+        if (job.name != wanted)
+            continue;
+        AlgorithmResult result = job.run();
+        if (!writeSeekSequenceTrace(outputPath, result, maxCylinder, error))
+        {
+            std::cerr << "Error: " << error << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+    std::cerr << "Error: unknown algorithm '" << algorithm << "'." << std::endl;
+    return 1;
+}
@@ -10,12 +10,34 @@
 #include "./Headers/DiskScheduling.h"
 #include "./Headers/QueueGeneration.h"
 #include "./Headers/InputOutput.h"
+#include "./Headers/TraceIO.h"
+#include "./Headers/Replay.h"
+#include "./Headers/Runner.h"
+#include "./Headers/Batch.h"
+#include "./Headers/Simulation.h"
 #include <iostream>
 #include <vector>
 #include <string>
+#include <chrono>
 
-int main()
+int main(int argc, char *argv[])
 {
+    // --- Online simulation: main --simulate [options] ---
+    if (argc > 1 && std::string(argv[1]) == "--simulate")
+        return simulateMain(argc, argv);
+
+    // --- Binary queue / seek-sequence traces: main --trace [options] ---
+    if (argc > 1 && std::string(argv[1]) == "--trace")
+        return traceMain(argc, argv);
+
+    // --- Block-trace replay: main --replay --input TRACE [options] ---
+    if (argc > 1 && std::string(argv[1]) == "--replay")
+        return replayMain(argc, argv);
+
+    // --- Non-interactive batch mode: main --batch [options] ---
+    if (argc > 1)
+        return batchMain(argc, argv);
+
     int startHead;
     int maxCylinder;
     std::vector<int> initialQueue;
@@ -29,15 +51,13 @@ int main()
 
     // --- Get Disk Performance Parameters ---
     std::cout << "\n--- Enter Disk Performance Parameters ---" << std::endl;
-    diskParams.avgSeekTimePerCylinderMs = getPositiveDoubleInput("Average Seek Time per Cylinder (ms): ", 0.0);
+    double seekTimePerCylinderMs = getPositiveDoubleInput("Average Seek Time per Cylinder (ms): ", 0.0);
     double rpm = getPositiveDoubleInput("Disk Rotational Speed (RPM): ", 1.0);
     double transferRateMBps = getPositiveDoubleInput("Disk Transfer Rate (MB/s): ", 0.001);
     double avgRequestSizeKB = getPositiveDoubleInput("Average Request Size (KB): ", 0.1);
 
     // Calculate derived performance parameters
-    diskParams.avgRotationalLatencyMs = (rpm > 0) ? (30000.0 / rpm) : 0.0; // (60 * 1000 / RPM) / 2
-    double transferRateKBpms = (transferRateMBps * 1024.0) / 1000.0;       // MB/s -> KB/s -> KB/ms
-    diskParams.transferTimePerRequestMs = (transferRateKBpms > 0) ? (avgRequestSizeKB / transferRateKBpms) : 0.0;
+    diskParams = deriveDiskParams(seekTimePerCylinderMs, rpm, transferRateMBps, avgRequestSizeKB);
 
     std::cout << std::fixed << std::setprecision(2); // Set precision for displaying calculated params
     std::cout << " -> Calculated Avg Rotational Latency: " << diskParams.avgRotationalLatencyMs << " ms" << std::endl;
@@ -47,7 +67,7 @@ int main()
     // --- Choose Queue Input Mode ---
     while (true)
     {
-        std::cout << "\nEnter 'm' for manual queue entry or 'g' to generate queue: ";
+        std::cout << "\nEnter 'm' for manual queue entry, 'g' to generate queue or 'f' to read a queue file: ";
         std::cin >> queueInputMode;
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
@@ -67,41 +87,77 @@ int main()
         }
         else if (queueInputMode == "g" || queueInputMode == "G")
         {
-            // Setup RNG
-            unsigned seed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
-            std::mt19937 rng(seed);
-
             printGenWelcome();                  // From InputOutput.h
             int genChoice = getGenUserChoice(); // From InputOutput.h
             int numRequestsGen = getPositiveIntInput("Number of Requests to Generate: ", 1);
 
             // Use functions from QueueGeneration.h
-            switch (genChoice)
+            QueuePattern pattern = static_cast<QueuePattern>(genChoice);
+            int numClusters = 1;
+            if (pattern == QueuePattern::Clustered)
+                numClusters = getPositiveIntInput("Desired Number of Clusters: ", 1, numRequestsGen);
+            WorkloadParams workload;
+            if (pattern == QueuePattern::Zipf || pattern == QueuePattern::Locality)
+                workload.zipfExponent = getPositiveDoubleInput("Zipf Exponent (0 = uniform, typical 0.8-1.2): ", 0.0, 10.0);
+            if (pattern == QueuePattern::HotCold)
             {
-            case 1:
-                initialQueue = generateUniformRandom(maxCylinder, numRequestsGen, rng);
-                break;
-            case 2:
-                initialQueue = generateSequential(maxCylinder, numRequestsGen, rng);
-                break;
-            case 3:
-            {
-                int nc = getPositiveIntInput("Desired Number of Clusters: ", 1, numRequestsGen);
-                initialQueue = generateClustered(maxCylinder, numRequestsGen, nc, rng);
+                workload.hotFraction = getPositiveDoubleInput("Hot Fraction of Cylinders (0-1): ", 0.0, 1.0);
+                workload.hotProbability = getPositiveDoubleInput("Fraction of Requests to Hot Cylinders (0-1): ", 0.0, 1.0);
             }
-            break;
-            case 4:
-                initialQueue = generateMixed(maxCylinder, numRequestsGen, rng);
-                break;
+            if (pattern == QueuePattern::Locality)
+                workload.meanRunLength = getPositiveDoubleInput("Mean Sequential Run Length: ", 1.0);
+            std::shared_ptr<const WorkloadModel> workloadModel;
+            if (isSkewedPattern(pattern))
+                workloadModel = buildWorkloadModel(pattern, maxCylinder, workload);
+
+            // The same seed reproduces the same queue on any machine and thread count
+            uint64_t seed = 0;
+            while (true)
+            {
+                std::cout << "Seed (blank for a random one): ";
+                std::string seedText;
+                std::getline(std::cin, seedText);
+                if (seedText.empty())
+                {
+                    seed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+                    break;
+                }
+                char *end = nullptr;
+                seed = std::strtoull(seedText.c_str(), &end, 10);
+                if (end != seedText.c_str() && *end == '\0')
+                    break;
+                std::cout << "Invalid seed. Please enter a non-negative integer." << std::endl;
             }
+            std::cout << "Using seed " << seed << "." << std::endl;
+            ThreadPool generationPool;
+            initialQueue = generatePatternParallel(pattern, maxCylinder, numRequestsGen, numClusters, seed, &generationPool,
+                                                   workloadModel.get());
             // Use functions from InputOutput.h
             printQueueGen(initialQueue);
             plotScatter(initialQueue, maxCylinder);
             break;
         }
+        else if (queueInputMode == "f" || queueInputMode == "F")
+        {
+            std::cout << "Queue file path (binary trace, or values separated by commas or whitespace): ";
+            std::string path, error;
+            std::getline(std::cin, path);
+            if (!loadQueueFile(path, initialQueue, error))
+            {
+                std::cerr << "Error: " << error << ". Retrying." << std::endl;
+                continue;
+            }
+            if (initialQueue.empty())
+            {
+                std::cerr << "Warning: Queue file contained no requests. Retrying." << std::endl;
+                continue;
+            }
+            std::cout << "Read " << initialQueue.size() << " requests." << std::endl;
+            break;
+        }
         else
         {
-            std::cout << "Invalid choice. Please enter 'm' or 'g'."
+            std::cout << "Invalid choice. Please enter 'm', 'g' or 'f'."
                       << std::endl;
         }
     }
@@ -135,23 +191,31 @@ int main()
     // --- Display Configuration (Using function from InputOutput.h) ---
     displayConfiguration(startHead, maxCylinder, diskParams, initialQueue);
 
-    // --- Run Simulations & Calculate Metrics (Using functions from DiskScheduling.h) ---
-    std::vector<AlgorithmResult> results;
+    // --- Run Simulations & Calculate Metrics (Using functions from Runner.h) ---
     int numRequests = initialQueue.size();
 
-    results.push_back(calculateMetrics("FCFS", fcfs(startHead, initialQueue), numRequests, diskParams));
-    results.push_back(calculateMetrics("SSTF", sstf(startHead, initialQueue), numRequests, diskParams));
-    results.push_back(calculateMetrics("SCAN", scan(startHead, maxCylinder, initialQueue), numRequests, diskParams));
-    results.push_back(calculateMetrics("C-SCAN", cscan(startHead, maxCylinder, initialQueue), numRequests, diskParams));
-    results.push_back(calculateMetrics("LOOK", look(startHead, initialQueue), numRequests, diskParams));
-    results.push_back(calculateMetrics("C-LOOK", clook(startHead, initialQueue), numRequests, diskParams));
-    results.push_back(calculateMetrics("HDSA", hdsa(startHead, initialQueue), numRequests, diskParams));
+    // Sort and split the queue once for all of the sweep-based algorithms
+    PreparedQueue preparedQueue = prepareQueue(startHead, initialQueue);
+
+    // Every request is queued at t = 0, so response time is pure queueing + service time
+    std::vector<Request> requests = makeRequests(initialQueue, avgRequestSizeKB);
+
+    // The algorithms only read the queue, so run them side by side on all cores
+    ThreadPool pool;
+    SuiteTiming timing;
+    MetricsOptions metricsOptions;
+    metricsOptions.collectPercentiles = true;
+    FairSchedulingParams fairParams;
+    std::vector<AlgorithmResult> results = runAlgorithmSuite(
+        standardAlgorithmJobs(startHead, maxCylinder, initialQueue, preparedQueue, diskParams, &requests, metricsOptions, fairParams),
+        pool, &timing);
 
     // --- Display Summary Table (Using function from InputOutput.h) ---
-    displaySummaryTable(results, numRequests);
+    displaySummaryTable(results, numRequests, true);
 
     // --- Display Notes (Using function from InputOutput.h) ---
-    displayNotes(numRequests);
+    displayNotes(numRequests, fairParams);
+    displaySuiteTiming(timing);
 
     return 0;
 }
\ No newline at end of file